@@ -17,6 +17,27 @@ MxxRu::Cpp::composite_target( MxxRu::BUILD_ROOT ) {
 #		required_prj "test/event_counter/prj.ut.rb" 
 		required_prj "test/sum_counter/prj.ut.rb" 
 		required_prj "test/volume_controller/prj.ut.rb" 
+		required_prj "test/atomic_event_counter/prj.ut.rb" 
+		required_prj "test/sharded_event_counter/prj.ut.rb" 
+		required_prj "test/compact_event_counter/prj.ut.rb" 
+		required_prj "test/fixed_sum_counter/prj.ut.rb" 
+		required_prj "test/fixed_event_counter/prj.ut.rb" 
+		required_prj "test/sliding_aggregator/prj.ut.rb" 
+		required_prj "test/quantile_counter/prj.ut.rb" 
+		required_prj "test/variance_counter/prj.ut.rb" 
+		required_prj "test/prefix_sum_counter/prj.ut.rb" 
+		required_prj "test/rollup_counter/prj.ut.rb" 
+		required_prj "test/atomic_sum_counter/prj.ut.rb" 
+		required_prj "test/merged_view/prj.ut.rb" 
+		required_prj "test/change_detector/prj.ut.rb" 
+		required_prj "test/ring_buffer/prj.ut.rb" 
+		required_prj "test/time_buckets/prj.ut.rb" 
+		required_prj "test/seqlock/prj.ut.rb" 
+#		required_prj "test/time_event_counter/prj.ut.rb" 
+#		required_prj "test/time_sum_counter/prj.ut.rb" 
+#		required_prj "test/outcome_counter/prj.ut.rb" 
+#		required_prj "test/circuit_breaker/prj.ut.rb" 
+#		required_prj "test/clock/prj.ut.rb" 
 #		required_prj "test/performance_assessor/prj.ut.rb" 
 #		required_prj "test/performance_estimator/prj.ut.rb" 
 }
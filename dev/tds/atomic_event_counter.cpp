@@ -0,0 +1,113 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/atomic_event_counter.hpp>
+
+#include <stdexcept>
+
+namespace tds {
+
+atomic_event_counter_t::atomic_event_counter_t(
+	unsigned int number ) :
+	m_number( number ), m_head( 0 ), m_count( 0 ),
+	m_store( ( number + 63 ) / 64 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at atomic_event_counter c'tor. Must be more than 0." );
+
+	for( unsigned int i = 0; i < m_store.size(); ++i )
+		m_store[i].store( 0, std::memory_order_relaxed );
+}
+
+void
+atomic_event_counter_t::event( bool what )
+{
+	const unsigned long long position =
+		m_head.fetch_add( 1, std::memory_order_relaxed ) % m_number;
+
+	std::atomic< unsigned long long > & word = m_store[ position / 64 ];
+	const unsigned long long mask = 1ULL << ( position % 64 );
+
+	// Change had place or not? Old value is returned by the same
+	// operation, so concurrent writers always agree about the change.
+	if ( what )
+	{
+		if ( !( word.fetch_or( mask, std::memory_order_relaxed ) & mask ) )
+			m_count.fetch_add( 1, std::memory_order_relaxed );
+	}
+	else
+	{
+		if ( word.fetch_and( ~mask, std::memory_order_relaxed ) & mask )
+			m_count.fetch_sub( 1, std::memory_order_relaxed );
+	}
+}
+
+unsigned int
+atomic_event_counter_t::count() const
+{
+	const int count = m_count.load( std::memory_order_relaxed );
+
+	if ( count < 0 )
+		return 0;
+
+	return static_cast< unsigned int >( count );
+}
+
+unsigned int
+atomic_event_counter_t::total() const
+{
+	const unsigned long long head = m_head.load( std::memory_order_relaxed );
+
+	if ( head < m_number )
+		return static_cast< unsigned int >( head );
+
+	return m_number;
+}
+
+float
+atomic_event_counter_t::percentage() const
+{
+	const unsigned int total_events = total();
+	if ( total_events == 0 )
+		return 0;
+
+	const unsigned int count_events = count();
+	if ( count_events >= total_events )
+		return 100;
+
+	return count_events * 100.0 / total_events;
+}
+
+} /* namespace tds */
@@ -0,0 +1,127 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/atomic_sum_counter.hpp>
+
+#include <tds/h/thread_index.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+namespace tds {
+
+atomic_sum_counter_t::atomic_sum_counter_t(
+	unsigned int number,
+	unsigned int partials ) :
+	m_number( number ), m_head( 0 ),
+	m_store( number ), m_partials( partials ), m_stride( 0 ), m_base( 0 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at atomic_sum_counter c'tor. Must be more than 0." );
+
+	for( unsigned int i = 0; i < m_store.size(); ++i )
+		m_store[i].store( 0, std::memory_order_relaxed );
+
+	if ( m_partials == 0 )
+		m_partials = std::thread::hardware_concurrency();
+	if ( m_partials == 0 )
+		m_partials = 1;
+
+	m_base = cache_aligned_blocks( m_sums, m_partials, 1, m_stride );
+}
+
+void
+atomic_sum_counter_t::event( unsigned int value )
+{
+	const unsigned long long position =
+		m_head.fetch_add( 1, std::memory_order_relaxed ) % m_number;
+
+	const unsigned int old =
+		m_store[ position ].exchange( value, std::memory_order_relaxed );
+
+	if ( old != value )
+	{
+		word_t & partial = m_base[ current_thread_index() % m_partials * m_stride ];
+
+		// Modulo 2^64: negative difference is wrapped.
+		partial.fetch_add(
+			static_cast< unsigned long long >( value ) - old,
+			std::memory_order_relaxed );
+	}
+}
+
+unsigned long long
+atomic_sum_counter_t::sum() const
+{
+	unsigned long long result = 0;
+
+	for( unsigned int i = 0; i < m_partials; ++i )
+		result += m_base[ i * m_stride ].load( std::memory_order_relaxed );
+
+	// Writer of the newer value may be ahead of the writer of the older one.
+	if ( static_cast< long long >( result ) < 0 )
+		return 0;
+
+	return result;
+}
+
+unsigned int
+atomic_sum_counter_t::total() const
+{
+	const unsigned long long head = m_head.load( std::memory_order_relaxed );
+
+	if ( head < m_number )
+		return static_cast< unsigned int >( head );
+
+	return m_number;
+}
+
+float
+atomic_sum_counter_t::mean() const
+{
+	const unsigned int total_events = total();
+	if ( total_events == 0 )
+		return 0;
+
+	return static_cast< float >( sum() ) / total_events;
+}
+
+unsigned int
+atomic_sum_counter_t::partials() const
+{
+	return m_partials;
+}
+
+} /* namespace tds */
@@ -0,0 +1,133 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/change_detector.hpp>
+
+#include <stdexcept>
+
+namespace tds {
+
+change_detector_t::change_detector_t(
+	double tolerance,
+	double threshold,
+	const callback_t & callback ) :
+	m_tolerance( tolerance ),
+	m_threshold( threshold ),
+	m_callback( callback ),
+	m_direction( change_detector::none )
+{
+	if ( threshold <= 0 )
+		throw std::runtime_error(
+			"Null threshold is detected at change_detector c'tor. Must be more than 0." );
+
+	if ( tolerance < 0 )
+		throw std::runtime_error(
+			"Negative tolerance is detected at change_detector c'tor. Must not be less than 0." );
+
+	restart();
+}
+
+void
+change_detector_t::event( double value )
+{
+	++m_total;
+	m_mean += ( value - m_mean ) / m_total;
+
+	m_up += value - m_mean - m_tolerance;
+	if ( m_up < m_up_min )
+		m_up_min = m_up;
+
+	m_down += value - m_mean + m_tolerance;
+	if ( m_down > m_down_max )
+		m_down_max = m_down;
+
+	change_detector::direction_t direction = change_detector::none;
+	if ( m_up - m_up_min > m_threshold )
+		direction = change_detector::increase;
+	else if ( m_down_max - m_down > m_threshold )
+		direction = change_detector::decrease;
+
+	if ( direction == change_detector::none )
+		return;
+
+	m_direction = direction;
+	restart();
+
+	if ( m_callback )
+		m_callback( direction );
+}
+
+bool
+change_detector_t::changed() const
+{
+	return m_direction != change_detector::none;
+}
+
+change_detector::direction_t
+change_detector_t::direction() const
+{
+	return m_direction;
+}
+
+double
+change_detector_t::mean() const
+{
+	return m_mean;
+}
+
+unsigned long long
+change_detector_t::total() const
+{
+	return m_total;
+}
+
+void
+change_detector_t::reset()
+{
+	m_direction = change_detector::none;
+	restart();
+}
+
+void
+change_detector_t::restart()
+{
+	m_total = 0;
+	m_mean = 0;
+	m_up = 0;
+	m_up_min = 0;
+	m_down = 0;
+	m_down_max = 0;
+}
+
+} /* namespace tds */
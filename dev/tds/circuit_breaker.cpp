@@ -0,0 +1,220 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/circuit_breaker.hpp>
+
+#include <stdexcept>
+
+#include "ace/Guard_T.h"
+
+namespace tds {
+
+circuit_breaker_t::circuit_breaker_t(
+	unsigned int number,
+	float failure_threshold,
+	unsigned int minimum_volume,
+	unsigned int consecutive_failures,
+	unsigned int open_period,
+	unsigned int probes,
+	const clock_interface_t & clock ) :
+	m_failures( number ),
+	m_failure_threshold( failure_threshold ),
+	m_minimum_volume( minimum_volume ),
+	m_consecutive_limit( consecutive_failures ),
+	m_open_period( open_period ),
+	m_probes( probes ),
+	m_clock( clock ),
+	m_state( circuit_breaker::closed ),
+	m_consecutive_failures( 0 ),
+	m_open_until( 0 ),
+	m_half_open_until( 0 ),
+	m_probes_allowed( 0 ),
+	m_probes_succeeded( 0 )
+{
+	if ( probes == 0 )
+		throw std::runtime_error(
+			"Null probes is detected at circuit_breaker c'tor. Must be more than 0." );
+}
+
+circuit_breaker::permit_t
+circuit_breaker_t::allow()
+{
+	int state = m_state.load( std::memory_order_acquire );
+
+	if ( state == circuit_breaker::closed )
+		return circuit_breaker::request;
+
+	if ( state == circuit_breaker::open )
+	{
+		if ( m_clock.now_msec() < m_open_until.load( std::memory_order_relaxed ) )
+			return circuit_breaker::denied;
+
+		ACE_Guard<ACE_Mutex> guard( m_state_locker );
+
+		// Open period is over, only one thread changes the state.
+		if ( m_state.load( std::memory_order_relaxed ) == circuit_breaker::open &&
+			m_clock.now_msec() >= m_open_until.load( std::memory_order_relaxed ) )
+		{
+			m_probes_allowed.store( 0, std::memory_order_relaxed );
+			m_probes_succeeded.store( 0, std::memory_order_relaxed );
+			m_half_open_until.store( m_clock.now_msec() + m_open_period,
+				std::memory_order_relaxed );
+			m_state.store( circuit_breaker::half_open, std::memory_order_release );
+		}
+
+		state = m_state.load( std::memory_order_relaxed );
+		if ( state == circuit_breaker::closed )
+			return circuit_breaker::request;
+		if ( state != circuit_breaker::half_open )
+			return circuit_breaker::denied;
+	}
+
+	if ( m_clock.now_msec() >= m_half_open_until.load( std::memory_order_relaxed ) )
+		rearm();
+
+	// Count of probes does not grow on denied calls.
+	unsigned int allowed = m_probes_allowed.load( std::memory_order_relaxed );
+	while( allowed < m_probes )
+		if ( m_probes_allowed.compare_exchange_weak(
+			allowed, allowed + 1, std::memory_order_relaxed ) )
+			return circuit_breaker::probe;
+
+	return circuit_breaker::denied;
+}
+
+void
+circuit_breaker_t::success( circuit_breaker::permit_t permit )
+{
+	const int state = m_state.load( std::memory_order_acquire );
+
+	if ( state == circuit_breaker::half_open )
+	{
+		// Late result of the request which was sent before the trip.
+		if ( permit != circuit_breaker::probe )
+			return;
+
+		if ( m_probes_succeeded.fetch_add( 1, std::memory_order_relaxed ) + 1 >= m_probes )
+			close();
+	}
+	else if ( state == circuit_breaker::closed )
+	{
+		m_consecutive_failures.store( 0, std::memory_order_relaxed );
+		m_failures.event( false );
+	}
+}
+
+void
+circuit_breaker_t::failure( circuit_breaker::permit_t permit )
+{
+	const int state = m_state.load( std::memory_order_acquire );
+
+	if ( state == circuit_breaker::half_open )
+	{
+		// Only probes count, late results of the requests
+		// which were sent before the trip are ignored.
+		if ( permit == circuit_breaker::probe )
+			trip();
+	}
+	else if ( state == circuit_breaker::closed )
+	{
+		m_failures.event( true );
+
+		const unsigned int consecutive =
+			m_consecutive_failures.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+		// Total and percentage of the same window.
+		const event_counter_snapshot_t failures = m_failures.snapshot();
+
+		if ( ( m_consecutive_limit != 0 && consecutive >= m_consecutive_limit ) ||
+			( failures.m_total >= m_minimum_volume &&
+				failures.percentage() >= m_failure_threshold ) )
+		{
+			trip();
+		}
+	}
+}
+
+circuit_breaker::state_t
+circuit_breaker_t::state() const
+{
+	return static_cast< circuit_breaker::state_t >(
+		m_state.load( std::memory_order_acquire ) );
+}
+
+float
+circuit_breaker_t::failure_percentage() const
+{
+	return m_failures.percentage();
+}
+
+void
+circuit_breaker_t::trip()
+{
+	ACE_Guard<ACE_Mutex> guard( m_state_locker );
+
+	if ( m_state.load( std::memory_order_relaxed ) == circuit_breaker::open )
+		return;
+
+	m_open_until.store( m_clock.now_msec() + m_open_period, std::memory_order_relaxed );
+	m_state.store( circuit_breaker::open, std::memory_order_release );
+}
+
+void
+circuit_breaker_t::close()
+{
+	ACE_Guard<ACE_Mutex> guard( m_state_locker );
+
+	if ( m_state.load( std::memory_order_relaxed ) != circuit_breaker::half_open )
+		return;
+
+	m_failures.reset();
+	m_consecutive_failures.store( 0, std::memory_order_relaxed );
+	m_state.store( circuit_breaker::closed, std::memory_order_release );
+}
+
+void
+circuit_breaker_t::rearm()
+{
+	ACE_Guard<ACE_Mutex> guard( m_state_locker );
+
+	if ( m_state.load( std::memory_order_relaxed ) != circuit_breaker::half_open ||
+		m_clock.now_msec() < m_half_open_until.load( std::memory_order_relaxed ) )
+		return;
+
+	m_probes_allowed.store( 0, std::memory_order_relaxed );
+	m_probes_succeeded.store( 0, std::memory_order_relaxed );
+	m_half_open_until.store( m_clock.now_msec() + m_open_period, std::memory_order_relaxed );
+}
+
+} /* namespace tds */
@@ -0,0 +1,184 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/clock.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+#include <time.h>
+
+#include <ace/OS_NS_sys_time.h>
+
+namespace tds {
+
+namespace {
+
+//! Time of the POSIX clock.
+ACE_Time_Value
+clock_time( clockid_t clock )
+{
+	timespec time;
+	::clock_gettime( clock, &time );
+
+	return ACE_Time_Value( time.tv_sec, time.tv_nsec / 1000 );
+}
+
+} /* namespace anonymous */
+
+//
+// system_clock_t
+//
+
+ACE_Time_Value
+system_clock_t::now() const
+{
+	return ACE_OS::gettimeofday();
+}
+
+//
+// monotonic_clock_t
+//
+
+ACE_Time_Value
+monotonic_clock_t::now() const
+{
+	return clock_time( CLOCK_MONOTONIC );
+}
+
+//
+// coarse_clock_t
+//
+
+ACE_Time_Value
+coarse_clock_t::now() const
+{
+#if defined( CLOCK_MONOTONIC_COARSE )
+	return clock_time( CLOCK_MONOTONIC_COARSE );
+#else
+	return clock_time( CLOCK_MONOTONIC );
+#endif
+}
+
+//
+// ticker_clock_t
+//
+
+ticker_clock_t::ticker_clock_t(
+	unsigned int period ) :
+	m_period( period ),
+	m_now( 0 ),
+	m_stop( false )
+{
+	if ( period == 0 )
+		throw std::runtime_error(
+			"Null period is detected at ticker_clock c'tor. Must be more than 0." );
+
+	const ACE_Time_Value time = monotonic_clock_t().now();
+	m_now.store( time.sec() * 1000000LL + time.usec(), std::memory_order_relaxed );
+
+	m_thread = std::thread( &ticker_clock_t::tick, this );
+}
+
+ticker_clock_t::~ticker_clock_t()
+{
+	m_stop.store( true, std::memory_order_relaxed );
+	m_thread.join();
+}
+
+ACE_Time_Value
+ticker_clock_t::now() const
+{
+	const long long now = m_now.load( std::memory_order_relaxed );
+
+	return ACE_Time_Value( now / 1000000, now % 1000000 );
+}
+
+void
+ticker_clock_t::tick()
+{
+	const monotonic_clock_t clock;
+
+	while( !m_stop.load( std::memory_order_relaxed ) )
+	{
+		std::this_thread::sleep_for( std::chrono::milliseconds( m_period ) );
+
+		const ACE_Time_Value time = clock.now();
+		m_now.store( time.sec() * 1000000LL + time.usec(), std::memory_order_relaxed );
+	}
+}
+
+//
+// virtual_clock_t
+//
+
+virtual_clock_t::virtual_clock_t(
+	const ACE_Time_Value & start ) :
+	m_now( start.sec() * 1000000LL + start.usec() )
+{
+}
+
+ACE_Time_Value
+virtual_clock_t::now() const
+{
+	const long long now = m_now.load( std::memory_order_acquire );
+
+	return ACE_Time_Value( now / 1000000, now % 1000000 );
+}
+
+void
+virtual_clock_t::set( const ACE_Time_Value & time )
+{
+	m_now.store( time.sec() * 1000000LL + time.usec(), std::memory_order_release );
+}
+
+void
+virtual_clock_t::advance( unsigned long long msec )
+{
+	m_now.fetch_add( msec * 1000, std::memory_order_acq_rel );
+}
+
+//
+// default_clock
+//
+
+const clock_interface_t &
+default_clock()
+{
+	static const system_clock_t clock;
+
+	return clock;
+}
+
+} /* namespace tds */
@@ -34,15 +34,33 @@
 
 #include <tds/h/event_counter.hpp>
 
-#include <stdexcept>
+#include <tds/h/bits.hpp>
 
-#include "ace/Guard_T.h"
+#include <algorithm>
+#include <stdexcept>
 
 namespace tds {
 
+namespace {
+
+//! Mask of bits [from, to) of the word.
+inline unsigned long long
+span_mask( unsigned int from, unsigned int to )
+{
+	const unsigned long long high = to == 64 ? ~0ULL : ( 1ULL << to ) - 1;
+	return high & ~( ( 1ULL << from ) - 1 );
+}
+
+} /* namespace anonymous */
+
+//
+// event_counter_t
+//
+
 event_counter_t::event_counter_t( 
 	unsigned int number ) : 
-	m_store( number, false ), m_pointer( 0 ), m_count( 0 ), m_total( 0 )
+	m_number( number ),
+	m_count( 0 ), m_total( 0 ), m_pointer( 0 ), m_store( ( number + 63 ) / 64, 0 )
 {
 	if ( number == 0 )
 		throw std::runtime_error( 
@@ -54,57 +72,154 @@ event_counter_t::event( bool what )
 {
 	ACE_Guard<ACE_Mutex> guard( m_store_locker );
 
-	// Change had place or not?
-	if ( m_store[m_pointer] != what )
-	{
-		if ( what )
-		{
-			// Change from false to true.
-			++m_count;
-		}
-		else
-		{
-			// Change from true to false.
-			--m_count;
-		}
+	store_event( what );
+	publish();
+}
+
+void
+event_counter_t::event_n( bool what, unsigned int n )
+{
+	if ( n == 0 )
+		return;
+
+	ACE_Guard<ACE_Mutex> guard( m_store_locker );
+
+	const unsigned int pointer = m_pointer;
 
-		m_store[m_pointer] = what;
+	if ( n >= m_number )
+	{
+		// All the buffer is overwritten.
+		fill_span( 0, m_number, what );
+		m_count = what ? m_number : 0;
+		m_total = m_number;
+		m_pointer = ( pointer + m_number - n % m_number ) % m_number;
+		publish();
+		return;
 	}
 
-	next_pointer();
+	// Events take pointer, pointer - 1, ... with wrap-around.
+	unsigned int overwritten = 0;
+	if ( n <= pointer + 1 )
+		overwritten = fill_span( pointer + 1 - n, pointer + 1, what );
+	else
+		overwritten = fill_span( 0, pointer + 1, what ) +
+			fill_span( m_number - ( n - pointer - 1 ), m_number, what );
+
+	m_count = m_count - overwritten + ( what ? n : 0 );
+	m_pointer = ( pointer + m_number - n ) % m_number;
+
+	if ( m_number - m_total > n )
+		m_total += n;
+	else
+		m_total = m_number;
+
+	publish();
 }
 
 unsigned int 
 event_counter_t::count() const
 {
-	return m_count;
+	return m_snapshot.load().m_count;
 }
 
 unsigned int 
 event_counter_t::total() const
 {
-	return m_total;
+	return m_snapshot.load().m_total;
 }
 
 float
 event_counter_t::percentage() const
 {
-	if ( m_total == 0 )
-		return 0;
+	return m_snapshot.load().percentage();
+}
+
+event_counter_snapshot_t
+event_counter_t::snapshot() const
+{
+	return m_snapshot.load();
+}
+
+void
+event_counter_t::reset()
+{
+	ACE_Guard<ACE_Mutex> guard( m_store_locker );
+
+	std::fill( m_store.begin(), m_store.end(), 0 );
+	m_pointer = 0;
+	m_count = 0;
+	m_total = 0;
+	publish();
+}
 
-	return m_count * 100.0 / m_total;
+void
+event_counter_t::publish()
+{
+	const event_counter_snapshot_t snapshot = { m_count, m_total };
+	m_snapshot.store( snapshot );
+}
+
+void
+event_counter_t::store_event( bool what )
+{
+	unsigned long long & word = m_store[ m_pointer / 64 ];
+	const unsigned long long mask = 1ULL << ( m_pointer % 64 );
+
+	// Change had place or not?
+	if ( ( ( word & mask ) != 0 ) != what )
+	{
+		if ( what )
+		{
+			// Change from false to true.
+			++m_count;
+			word |= mask;
+		}
+		else
+		{
+			// Change from true to false.
+			--m_count;
+			word &= ~mask;
+		}
+	}
+
+	next_pointer();
 }
 
 void
 event_counter_t::next_pointer() 
 {
 	if ( m_pointer == 0 )
-		m_pointer = m_store.size() - 1;
+		m_pointer = m_number - 1;
 	else
 		--m_pointer;
 
-	if ( m_total < m_store.size() ) 
+	if ( m_total < m_number ) 
 		++m_total;
 }
 
+unsigned int
+event_counter_t::fill_span( unsigned int from, unsigned int to, bool what )
+{
+	unsigned int overwritten = 0;
+
+	while( from < to )
+	{
+		const unsigned int bit = from % 64;
+		const unsigned int bits = std::min( 64 - bit, to - from );
+		const unsigned long long mask = span_mask( bit, bit + bits );
+
+		unsigned long long & word = m_store[ from / 64 ];
+		overwritten += popcount( word & mask );
+
+		if ( what )
+			word |= mask;
+		else
+			word &= ~mask;
+
+		from += bits;
+	}
+
+	return overwritten;
+}
+
 } /* namespace tds */
@@ -0,0 +1,106 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__ATOMIC_EVENT_COUNTER_HPP__INCLUDED )
+#define _TDS__ATOMIC_EVENT_COUNTER_HPP__INCLUDED
+
+#include <atomic>
+#include <vector>
+
+namespace tds {
+
+//! Lock-free version of event_counter_t.
+/*!
+	Stores facts about last N events, no more.
+	Window is kept in atomic 64-bit words, so event() is a few
+	atomic operations and readers never block.
+
+	Thread-safe. Values are exact when writers are quiescent;
+	while writers are running count() and total() may be
+	updated not simultaneously.
+*/
+class atomic_event_counter_t
+{
+	public:
+		atomic_event_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number );
+
+		//! Event was happened (true/false).
+		/*!
+			true - positive (happened)
+			false - negative.
+		*/
+		void
+		event( bool what );
+
+		//! Get count of true-events.
+		unsigned int
+		count() const;
+
+		//! Total count of happened events.
+		unsigned int
+		total() const;
+
+		//! Get percentage value of true-events.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		percentage() const;
+
+	private:
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Sequence number of the next event.
+		/*!
+			Position in the buffer is m_head % m_number.
+		*/
+		std::atomic< unsigned long long > m_head;
+
+		//! Count of the happened events.
+		/*!
+			Signed: two writers racing for the same position may
+			decrement it before the increment takes place.
+		*/
+		std::atomic< int > m_count;
+
+		//! Saves successfulness of all (N) previous events, 64 per word.
+		std::vector< std::atomic< unsigned long long > > m_store;
+};
+
+} /* namespace tds */
+
+#endif
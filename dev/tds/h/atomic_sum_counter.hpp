@@ -0,0 +1,133 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__ATOMIC_SUM_COUNTER_HPP__INCLUDED )
+#define _TDS__ATOMIC_SUM_COUNTER_HPP__INCLUDED
+
+#include <atomic>
+#include <vector>
+
+namespace tds {
+
+//! Lock-free version of sum_counter_t.
+/*!
+	Stores sums about last N events, no more.
+
+	Writer claims the position by fetch_add on the head and exchanges
+	the value in the buffer. Difference between the new and the old
+	value is added to the partial sum of the writer's thread; partial
+	sums are in their own cache lines, so writers do not share them.
+	sum() adds the partial sums up without locks.
+
+	With one writer results are the same as sum_counter_t has.
+
+	Thread-safe. Values are exact when writers are quiescent;
+	while writers are running sum() and total() may be
+	updated not simultaneously.
+*/
+class atomic_sum_counter_t
+{
+	public:
+		atomic_sum_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number,
+			//! Count of partial sums.
+			/*!
+				0 - by count of hardware threads.
+			*/
+			unsigned int partials = 0 );
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( unsigned int value );
+
+		//! Get sum of happened events.
+		unsigned long long
+		sum() const;
+
+		//! Total counted events.
+		unsigned int
+		total() const;
+
+		//! Get arithmetic mean.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		mean() const;
+
+		//! Count of partial sums.
+		unsigned int
+		partials() const;
+
+	private:
+		typedef std::atomic< unsigned long long > word_t;
+
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Sequence number of the next event.
+		/*!
+			Position in the buffer is m_head % m_number.
+		*/
+		std::atomic< unsigned long long > m_head;
+
+		//! Saves values of all (N) previous events.
+		std::vector< std::atomic< unsigned int > > m_store;
+
+		//! Count of partial sums.
+		unsigned int m_partials;
+
+		//! Distance between partial sums, in words (one cache line).
+		unsigned int m_stride;
+
+		//! Storage of partial sums.
+		/*!
+			Partial sums are wrapped by modulo 2^64, their sum
+			is the sum of the buffer.
+
+			Is not aligned, m_base points to the first cache line.
+		*/
+		std::vector< word_t > m_sums;
+
+		//! First partial sum (aligned to the cache line).
+		word_t * m_base;
+};
+
+} /* namespace tds */
+
+#endif
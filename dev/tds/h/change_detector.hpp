@@ -0,0 +1,153 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__CHANGE_DETECTOR_HPP__INCLUDED )
+#define _TDS__CHANGE_DETECTOR_HPP__INCLUDED
+
+#include <functional>
+
+namespace tds {
+
+namespace change_detector {
+
+//! Directions of the change.
+enum direction_t
+{
+	//! There was no change.
+	none,
+	//! Values became bigger.
+	increase,
+	//! Values became smaller.
+	decrease
+};
+
+} /* namespace change_detector */
+
+//! Detects shifts of the mean of special number events (latency, size, ... ).
+/*!
+	Two-sided Page-Hinkley test. Deviations of values from the mean
+	of all values since the last change are accumulated; the change
+	is detected when the accumulated deviation goes away from its
+	minimum (maximum for decrease) for more than the threshold.
+
+	Small tolerance and threshold make detection faster and
+	false alarms more frequent.
+
+	When the change is detected, the flag is raised and the callback
+	is called; statistics are started from scratch, so the next change
+	is detected relative to the new mean.
+
+	event() is O(1), memory does not depend on count of events.
+
+	Not thread-safe.
+*/
+class change_detector_t
+{
+	public:
+		//! Callback which is called on the change.
+		typedef std::function< void ( change_detector::direction_t ) > callback_t;
+
+		change_detector_t(
+			//! Tolerance: shift of the mean which is not a change.
+			double tolerance,
+			//! Threshold of the accumulated deviation.
+			double threshold,
+			//! Callback on the change (can be empty).
+			const callback_t & callback = callback_t() );
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( double value );
+
+		//! Was the change detected since the last reset()?
+		bool
+		changed() const;
+
+		//! Direction of the last detected change.
+		change_detector::direction_t
+		direction() const;
+
+		//! Mean of values since the last change.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		double
+		mean() const;
+
+		//! Count of events since the last change.
+		unsigned long long
+		total() const;
+
+		//! Forgets all events and the detected change.
+		void
+		reset();
+
+	private:
+		//! Starts statistics from scratch.
+		void
+		restart();
+
+		//! Tolerance: shift of the mean which is not a change.
+		const double m_tolerance;
+
+		//! Threshold of the accumulated deviation.
+		const double m_threshold;
+
+		//! Callback on the change.
+		callback_t m_callback;
+
+		//! Count of events since the last change.
+		unsigned long long m_total;
+
+		//! Mean of values since the last change.
+		double m_mean;
+
+		//! Accumulated deviation for increase and its minimum.
+		double m_up;
+		double m_up_min;
+
+		//! Accumulated deviation for decrease and its maximum.
+		double m_down;
+		double m_down_max;
+
+		//! Direction of the last detected change.
+		change_detector::direction_t m_direction;
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,203 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__CIRCUIT_BREAKER_HPP__INCLUDED )
+#define _TDS__CIRCUIT_BREAKER_HPP__INCLUDED
+
+#include <tds/h/clock.hpp>
+#include <tds/h/event_counter.hpp>
+
+#include <atomic>
+
+#include "ace/Mutex.h"
+
+namespace tds {
+
+namespace circuit_breaker {
+
+//! States of the circuit breaker.
+enum state_t
+{
+	//! Requests are allowed, results are counted.
+	closed,
+	//! Requests are not allowed until the open period is over.
+	open,
+	//! Limited count of probe requests is allowed.
+	half_open
+};
+
+//! Permission of allow() for the request.
+enum permit_t
+{
+	//! Request must not be sent.
+	denied = 0,
+	//! Ordinary request.
+	request,
+	//! Probe request of the half-open state.
+	probe
+};
+
+};
+
+//! Stops requests to the failing destination.
+/*!
+	Results of the requests are counted in the window of last N events.
+	Breaker is opened when the percentage of failures in the window
+	reaches the threshold (if there are enough events in the window),
+	or when there are too many consecutive failures.
+
+	After the open period the breaker lets through a few probe requests
+	(half-open state). If all of them are successful the breaker is closed
+	with the empty window, the first failure opens it again.
+	Only results of probes count in the half-open state: the permit
+	of allow() must be given back to success() or failure(), so late
+	results of requests sent before the trip are ignored.
+	If results of the probes are lost, new probes are let through
+	after one more open period of the half-open state.
+
+	allow() in the closed state is one atomic load.
+
+	Thread-safe.
+*/
+class circuit_breaker_t
+{
+	public:
+		circuit_breaker_t(
+			//! Count of maximum events in the window (buffer size).
+			unsigned int number,
+			//! Percentage of failures in the window to open the breaker.
+			float failure_threshold,
+			//! Minimum count of events in the window to use the percentage.
+			unsigned int minimum_volume,
+			//! Count of consecutive failures to open the breaker.
+			/*!
+				0 - consecutive failures are not used.
+			*/
+			unsigned int consecutive_failures,
+			//! Duration of the open state, ms.
+			unsigned int open_period,
+			//! Count of probe requests in the half-open state.
+			unsigned int probes = 1,
+			//! Source of the current time.
+			const clock_interface_t & clock = default_clock() );
+
+		//! Can the request be sent?
+		/*!
+			circuit_breaker::denied (false) - can't be sent.
+			In the half-open state the permit is circuit_breaker::probe,
+			its result must be reported by success() or failure()
+			with this permit.
+		*/
+		circuit_breaker::permit_t
+		allow();
+
+		//! Request was successful.
+		void
+		success(
+			//! Permit which was given by allow() for the request.
+			circuit_breaker::permit_t permit = circuit_breaker::request );
+
+		//! Request was failed.
+		void
+		failure(
+			//! Permit which was given by allow() for the request.
+			circuit_breaker::permit_t permit = circuit_breaker::request );
+
+		//! Current state.
+		circuit_breaker::state_t
+		state() const;
+
+		//! Percentage of failures in the window.
+		float
+		failure_percentage() const;
+
+	private:
+		//! Opens the breaker.
+		void
+		trip();
+
+		//! Closes the breaker after successful probes.
+		void
+		close();
+
+		//! Lets through new probes if results of the probes are lost.
+		void
+		rearm();
+
+		//! Failures in the window (true - failure).
+		event_counter_t m_failures;
+
+		//! Percentage of failures to open the breaker.
+		const float m_failure_threshold;
+
+		//! Minimum count of events in the window to use the percentage.
+		const unsigned int m_minimum_volume;
+
+		//! Count of consecutive failures to open the breaker.
+		const unsigned int m_consecutive_limit;
+
+		//! Duration of the open state, ms.
+		const unsigned int m_open_period;
+
+		//! Count of probe requests in the half-open state.
+		const unsigned int m_probes;
+
+		//! Source of the current time.
+		const clock_interface_t & m_clock;
+
+		//! Current state (circuit_breaker::state_t).
+		std::atomic< int > m_state;
+
+		//! Count of the current consecutive failures.
+		std::atomic< unsigned int > m_consecutive_failures;
+
+		//! Time when the open state is over, ms.
+		std::atomic< unsigned long long > m_open_until;
+
+		//! Time when the probes of the half-open state are lost, ms.
+		std::atomic< unsigned long long > m_half_open_until;
+
+		//! Count of the allowed probes in the half-open state.
+		std::atomic< unsigned int > m_probes_allowed;
+
+		//! Count of the successful probes in the half-open state.
+		std::atomic< unsigned int > m_probes_succeeded;
+
+		//! Locker for changes of the state.
+		ACE_Mutex m_state_locker;
+};
+
+} /* namespace tds */
+
+#endif
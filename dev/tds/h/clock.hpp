@@ -0,0 +1,193 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__CLOCK_HPP__INCLUDED )
+#define _TDS__CLOCK_HPP__INCLUDED
+
+#include <atomic>
+#include <thread>
+
+#include <ace/Time_Value.h>
+
+namespace tds {
+
+//! Source of time for time-based structures.
+/*!
+	Structures take the clock by reference in the c'tor,
+	the clock must live longer than the structures.
+	Time of one structure must be taken from one clock only.
+*/
+class clock_interface_t
+{
+	public:
+		virtual
+		~clock_interface_t() {}
+
+		//! Current time.
+		virtual ACE_Time_Value
+		now() const = 0;
+
+		//! Current time, ms.
+		unsigned long long
+		now_msec() const
+		{
+			const ACE_Time_Value time = now();
+
+			ACE_UINT64 result;
+			time.msec( result );
+			return result;
+		}
+};
+
+//! Wall-clock time (ACE_OS::gettimeofday()).
+/*!
+	Jumps when the system time is changed.
+*/
+class system_clock_t : public clock_interface_t
+{
+	public:
+		virtual ACE_Time_Value
+		now() const;
+};
+
+//! Monotonic time (CLOCK_MONOTONIC).
+/*!
+	Does not jump, counted from an unspecified moment.
+*/
+class monotonic_clock_t : public clock_interface_t
+{
+	public:
+		virtual ACE_Time_Value
+		now() const;
+};
+
+//! Coarse monotonic time (CLOCK_MONOTONIC_COARSE).
+/*!
+	Cheaper than monotonic_clock_t, precision is a system tick
+	(a few ms). Is monotonic_clock_t where coarse clock is absent.
+*/
+class coarse_clock_t : public clock_interface_t
+{
+	public:
+		virtual ACE_Time_Value
+		now() const;
+};
+
+//! Monotonic time which is refreshed by the background thread.
+/*!
+	Thread takes the time from monotonic_clock_t every period and
+	stores it into the atomic, so now() is one atomic load without
+	the system call. Precision is the period.
+
+	One ticker can be shared by many structures.
+*/
+class ticker_clock_t : public clock_interface_t
+{
+	public:
+		ticker_clock_t(
+			//! Period of refreshing, ms.
+			unsigned int period = 1 );
+
+		~ticker_clock_t();
+
+		virtual ACE_Time_Value
+		now() const;
+
+	private:
+		ticker_clock_t( const ticker_clock_t & );
+		ticker_clock_t &
+		operator = ( const ticker_clock_t & );
+
+		//! Loop of the background thread.
+		void
+		tick();
+
+		//! Period of refreshing, ms.
+		const unsigned int m_period;
+
+		//! Last taken time, us.
+		std::atomic< long long > m_now;
+
+		//! Stop flag for the background thread.
+		std::atomic< bool > m_stop;
+
+		//! Background thread.
+		std::thread m_thread;
+};
+
+//! Time which is moved only by the owner.
+/*!
+	For tests and simulations: time-based structures see the time
+	which is set by set() and advance(), so hours of the load
+	are replayed in CPU time only and results do not depend on
+	the scheduler.
+
+	Thread-safe.
+*/
+class virtual_clock_t : public clock_interface_t
+{
+	public:
+		virtual_clock_t(
+			//! Start time.
+			const ACE_Time_Value & start = ACE_Time_Value( 0 ) );
+
+		virtual ACE_Time_Value
+		now() const;
+
+		//! Sets the current time.
+		void
+		set( const ACE_Time_Value & time );
+
+		//! Moves the current time forward.
+		void
+		advance(
+			//! Step, ms.
+			unsigned long long msec );
+
+	private:
+		virtual_clock_t( const virtual_clock_t & );
+		virtual_clock_t &
+		operator = ( const virtual_clock_t & );
+
+		//! Current time, us.
+		std::atomic< long long > m_now;
+};
+
+//! Clock which is used by default (system_clock_t).
+const clock_interface_t &
+default_clock();
+
+} /* namespace tds */
+
+#endif
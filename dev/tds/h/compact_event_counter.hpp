@@ -0,0 +1,149 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__COMPACT_EVENT_COUNTER_HPP__INCLUDED )
+#define _TDS__COMPACT_EVENT_COUNTER_HPP__INCLUDED
+
+#include <tds/h/bits.hpp>
+#include <tds/h/event_counter_snapshot.hpp>
+
+#include <atomic>
+
+namespace tds {
+
+//! Counts facts that events already happened in one 64-bit word.
+/*!
+	Stores facts about last N events, no more. N is up to 58.
+
+	Whole state is one word: low N bits are the window
+	(shift register, the last event is in bit 0), high 6 bits
+	are the total count of events. count() is popcount of the window.
+	No heap allocation, sizeof is 8 bytes.
+
+	Thread-safe: event() is a compare-and-swap loop on the word.
+	count() and total() load the word separately, snapshot() and
+	percentage() take both values from one load.
+*/
+template< unsigned int N >
+class compact_event_counter_t
+{
+	static_assert( N > 0 && N <= 58,
+		"compact_event_counter_t can hold from 1 to 58 events" );
+
+	public:
+		compact_event_counter_t() :
+			m_state( 0 )
+		{}
+
+		//! Event was happened (true/false).
+		/*!
+			true - positive (happened)
+			false - negative.
+		*/
+		void
+		event( bool what )
+		{
+			unsigned long long state = m_state.load( std::memory_order_relaxed );
+			unsigned long long next;
+
+			do
+			{
+				const unsigned long long total = state >> total_shift;
+
+				next = ( ( state << 1 ) | ( what ? 1 : 0 ) ) & window_mask;
+				next |= ( total < N ? total + 1 : total ) << total_shift;
+			}
+			while( !m_state.compare_exchange_weak(
+				state, next, std::memory_order_relaxed ) );
+		}
+
+		//! Get count of true-events.
+		unsigned int
+		count() const
+		{
+			return popcount( m_state.load( std::memory_order_relaxed ) & window_mask );
+		}
+
+		//! Total count of happened events.
+		unsigned int
+		total() const
+		{
+			return static_cast< unsigned int >(
+				m_state.load( std::memory_order_relaxed ) >> total_shift );
+		}
+
+		//! Get percentage value of true-events.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		percentage() const
+		{
+			const unsigned long long state = m_state.load( std::memory_order_relaxed );
+			const unsigned int total_events =
+				static_cast< unsigned int >( state >> total_shift );
+
+			if ( total_events == 0 )
+				return 0;
+
+			return popcount( state & window_mask ) * 100.0 / total_events;
+		}
+
+		//! Get count and total of the same moment.
+		event_counter_snapshot_t
+		snapshot() const
+		{
+			const unsigned long long state = m_state.load( std::memory_order_relaxed );
+
+			const event_counter_snapshot_t snapshot = {
+				popcount( state & window_mask ),
+				static_cast< unsigned int >( state >> total_shift ) };
+
+			return snapshot;
+		}
+
+	private:
+		//! Position of the total count of events.
+		static const unsigned int total_shift = 58;
+
+		//! Bits of the window.
+		static const unsigned long long window_mask = ( 1ULL << N ) - 1;
+
+		//! Window and total count of events.
+		std::atomic< unsigned long long > m_state;
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,113 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__COMPENSATED_SUM_HPP__INCLUDED )
+#define _TDS__COMPENSATED_SUM_HPP__INCLUDED
+
+namespace tds {
+
+//! Sum of floating point values with compensation of rounding errors.
+/*!
+	Kahan-Babuska (Neumaier) summation: lost low bits of every
+	addition are collected separately, so the error does not grow
+	with the count of added and subtracted values.
+
+	Can be used as accumulator of basic_sum_counter_t.
+*/
+template< typename VALUE >
+class compensated_sum_t
+{
+	public:
+		compensated_sum_t() :
+			m_sum( 0 ), m_compensation( 0 )
+		{}
+
+		compensated_sum_t( VALUE value ) :
+			m_sum( value ), m_compensation( 0 )
+		{}
+
+		compensated_sum_t &
+		operator += ( VALUE value )
+		{
+			const VALUE sum = m_sum + value;
+
+			if ( ( m_sum < 0 ? -m_sum : m_sum ) >= ( value < 0 ? -value : value ) )
+				m_compensation += ( m_sum - sum ) + value;
+			else
+				m_compensation += ( value - sum ) + m_sum;
+
+			m_sum = sum;
+
+			return *this;
+		}
+
+		compensated_sum_t &
+		operator -= ( VALUE value )
+		{
+			return *this += -value;
+		}
+
+		//! Compensated value of the sum.
+		operator VALUE () const
+		{
+			return m_sum + m_compensation;
+		}
+
+	private:
+		//! Rounded sum.
+		VALUE m_sum;
+
+		//! Lost low bits of the sum.
+		VALUE m_compensation;
+};
+
+//! Type of the value of the accumulator.
+/*!
+	Accumulator itself for arithmetic types.
+*/
+template< typename ACCUMULATOR >
+struct accumulator_traits_t
+{
+	typedef ACCUMULATOR value_type;
+};
+
+template< typename VALUE >
+struct accumulator_traits_t< compensated_sum_t< VALUE > >
+{
+	typedef VALUE value_type;
+};
+
+} /* namespace tds */
+
+#endif
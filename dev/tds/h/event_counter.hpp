@@ -38,6 +38,10 @@
 #include <vector>
 
 #include "ace/Mutex.h"
+#include "ace/Guard_T.h"
+
+#include <tds/h/event_counter_snapshot.hpp>
+#include <tds/h/seqlock.hpp>
 
 namespace tds {
 
@@ -45,7 +49,9 @@ namespace tds {
 /*!
 	Stores facts about last N events, no more.
 
-	Thread-safe.
+	Thread-safe. Readers do not take the lock: count, total and
+	percentage are taken from the snapshot which is published
+	by every write.
 */
 class event_counter_t
 {
@@ -62,6 +68,29 @@ class event_counter_t
 		void
 		event( bool what );
 
+		//! The same event was happened n times.
+		/*!
+			Buffer is updated by words, one lock for all events.
+		*/
+		void
+		event_n( bool what, unsigned int n );
+
+		//! Events of the range were happened (in order of the range).
+		/*!
+			One lock for all events.
+		*/
+		template< typename ITERATOR >
+		void
+		events( ITERATOR first, ITERATOR last )
+		{
+			ACE_Guard<ACE_Mutex> guard( m_store_locker );
+
+			for( ; first != last; ++first )
+				store_event( *first );
+
+			publish();
+		}
+
 		//! Get count of true-events.
 		unsigned int 
 		count() const;
@@ -77,12 +106,41 @@ class event_counter_t
 		float
 		percentage() const;
 
+		//! Get count and total of the same moment.
+		/*!
+			Never blocks writers.
+		*/
+		event_counter_snapshot_t
+		snapshot() const;
+
+		//! Forgets all events.
+		void
+		reset();
+
 	private:
 
+		//! Stores event without lock.
+		void
+		store_event( bool what );
+
+		//! Publishes count and total for readers.
+		void
+		publish();
+
 		//! Moves pointer to the next event.
 		void
 		next_pointer();
 
+		//! Fills the buffer at [from, to) by the event.
+		/*!
+			\return count of true-events which were overwritten.
+		*/
+		unsigned int
+		fill_span( unsigned int from, unsigned int to, bool what );
+
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
 		//! Count of the happened events.
 		unsigned int m_count;
 
@@ -93,10 +151,13 @@ class event_counter_t
 		//! Point out to the element which will be changed next time.
 		int m_pointer;
 
-		//! Saves successfulness of all (N) previous events.
-		std::vector <bool> m_store;
+		//! Saves successfulness of all (N) previous events, 64 per word.
+		std::vector <unsigned long long> m_store;
 
 		ACE_Mutex m_store_locker;
+
+		//! Count and total for readers.
+		seqlock_t< event_counter_snapshot_t > m_snapshot;
 };
 
 } /* namespace tds */
@@ -0,0 +1,75 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__EVENT_COUNTER_SNAPSHOT_HPP__INCLUDED )
+#define _TDS__EVENT_COUNTER_SNAPSHOT_HPP__INCLUDED
+
+namespace tds {
+
+//! Consistent state of the event counter.
+struct event_counter_snapshot_t
+{
+	//! Count of true-events.
+	unsigned int m_count;
+
+	//! Total count of happened events.
+	unsigned int m_total;
+
+	//! Get percentage value of true-events.
+	/*!
+		If there were 0 events, result of this function will be 0.
+	*/
+	float
+	percentage() const
+	{
+		if ( m_total == 0 )
+			return 0;
+
+		return m_count * 100.0 / m_total;
+	}
+
+	//! Adds events of the other counter (other shard, thread, ... ).
+	event_counter_snapshot_t &
+	merge( const event_counter_snapshot_t & other )
+	{
+		m_count += other.m_count;
+		m_total += other.m_total;
+
+		return *this;
+	}
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,136 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__FIXED_EVENT_COUNTER_HPP__INCLUDED )
+#define _TDS__FIXED_EVENT_COUNTER_HPP__INCLUDED
+
+#include <bitset>
+
+namespace tds {
+
+//! event_counter_t with the window size known at compile time.
+/*!
+	Stores facts about last N events, no more.
+
+	Buffer is inside the object, there is no heap allocation.
+	For N which is a power of two the pointer is moved by mask,
+	so event() has no branches and is inlined completely.
+
+	Not thread-safe (unlike event_counter_t): it is for the single
+	writer or for the writers under the own lock.
+*/
+template< unsigned int N >
+class fixed_event_counter_t
+{
+	static_assert( N > 0, "fixed_event_counter_t must have at least one event" );
+
+	public:
+		fixed_event_counter_t() :
+			m_count( 0 ), m_total( 0 ), m_pointer( 0 )
+		{}
+
+		//! Event was happened (true/false).
+		/*!
+			true - positive (happened)
+			false - negative.
+		*/
+		void
+		event( bool what )
+		{
+			m_count += what;
+			m_count -= m_store[ m_pointer ];
+			m_store[ m_pointer ] = what;
+
+			m_pointer = next_pointer( m_pointer );
+			m_total += m_total < N;
+		}
+
+		//! Get count of true-events.
+		unsigned int
+		count() const
+		{
+			return m_count;
+		}
+
+		//! Total count of happened events.
+		unsigned int
+		total() const
+		{
+			return m_total;
+		}
+
+		//! Get percentage value of true-events.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		percentage() const
+		{
+			if ( m_total == 0 )
+				return 0;
+
+			return m_count * 100.0 / m_total;
+		}
+
+	private:
+		//! Is N a power of two?
+		static const bool power_of_two = ( N & ( N - 1 ) ) == 0;
+
+		//! Pointer to the next event.
+		static unsigned int
+		next_pointer( unsigned int pointer )
+		{
+			if ( power_of_two )
+				return ( pointer + 1 ) & ( N - 1 );
+
+			return pointer + 1 == N ? 0 : pointer + 1;
+		}
+
+		//! Count of the happened events.
+		unsigned int m_count;
+
+		//! Total count of happened events.
+		unsigned int m_total;
+
+		//! Pointer to the moving through buffer.
+		//! Point out to the element which will be changed next time.
+		unsigned int m_pointer;
+
+		//! Saves successfulness of all (N) previous events.
+		std::bitset< N > m_store;
+};
+
+} /* namespace tds */
+
+#endif
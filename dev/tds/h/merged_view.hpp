@@ -0,0 +1,95 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__MERGED_VIEW_HPP__INCLUDED )
+#define _TDS__MERGED_VIEW_HPP__INCLUDED
+
+#include <type_traits>
+
+namespace tds {
+
+//! Counter itself.
+template< typename COUNTER >
+const COUNTER &
+counter_of( const COUNTER & counter )
+{
+	return counter;
+}
+
+//! Counter by pointer.
+template< typename COUNTER >
+const COUNTER &
+counter_of( const COUNTER * counter )
+{
+	return *counter;
+}
+
+//! Counter by pointer.
+template< typename COUNTER >
+const COUNTER &
+counter_of( COUNTER * counter )
+{
+	return *counter;
+}
+
+//! Merged snapshots of the range of counters (shards, threads, ... ).
+/*!
+	Counters are given by objects or by pointers: event_counter_t,
+	sum_counter_t, performance_estimator_t, performance_assessor_t
+	or any other type with snapshot() and mergeable result of it.
+
+	Snapshots are taken without locks, so writers are not blocked.
+	If the range is empty, result is the empty snapshot.
+*/
+template< typename ITERATOR >
+auto
+merged_view( ITERATOR first, ITERATOR last ) ->
+	typename std::decay< decltype( counter_of( *first ).snapshot() ) >::type
+{
+	typedef typename std::decay<
+		decltype( counter_of( *first ).snapshot() ) >::type snapshot_t;
+
+	if ( first == last )
+		return snapshot_t();
+
+	snapshot_t result = counter_of( *first ).snapshot();
+	for( ++first; first != last; ++first )
+		result.merge( counter_of( *first ).snapshot() );
+
+	return result;
+}
+
+} /* namespace tds */
+
+#endif
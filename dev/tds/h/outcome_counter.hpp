@@ -0,0 +1,192 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__OUTCOME_COUNTER_HPP__INCLUDED )
+#define _TDS__OUTCOME_COUNTER_HPP__INCLUDED
+
+#include <vector>
+#include <stdexcept>
+
+#include "ace/Mutex.h"
+#include "ace/Guard_T.h"
+
+namespace tds {
+
+//! Counts outcomes of events (success, timeout, error, ... ).
+/*!
+	Stores outcomes of last N events, no more.
+	Outcome is a value of enum OUTCOME from 0 to OUTCOMES - 1.
+
+	Each event takes 2 bits of the buffer (up to 4 outcomes)
+	or 4 bits (up to 16 outcomes). Counts of all outcomes are
+	updated incrementally, so one event() is one lock and
+	count() and share() are O(1).
+
+	Thread-safe.
+*/
+template< typename OUTCOME, unsigned int OUTCOMES >
+class outcome_counter_t
+{
+	static_assert( OUTCOMES >= 2 && OUTCOMES <= 16,
+		"outcome_counter_t can count from 2 to 16 outcomes" );
+
+	public:
+		outcome_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number ) :
+			m_number( number ), m_total( 0 ), m_pointer( 0 ),
+			m_store( ( number + slots_per_word - 1 ) / slots_per_word, 0 )
+		{
+			if ( number == 0 )
+				throw std::runtime_error(
+					"Null number is detected at outcome_counter c'tor. Must be more than 0." );
+
+			for( unsigned int i = 0; i < OUTCOMES; ++i )
+				m_counts[i] = 0;
+		}
+
+		//! Event was happened with the outcome.
+		/*!
+			Outcome out of [0, OUTCOMES) throws std::runtime_error.
+		*/
+		void
+		event( OUTCOME what )
+		{
+			const unsigned int outcome = index( what );
+
+			ACE_Guard<ACE_Mutex> guard( m_store_locker );
+
+			const unsigned int shift = ( m_pointer % slots_per_word ) * slot_bits;
+			unsigned long long & word = m_store[ m_pointer / slots_per_word ];
+
+			// Outcome in the slot is actual only if the buffer is full.
+			if ( m_total == m_number )
+				--m_counts[ ( word >> shift ) & slot_mask ];
+			else
+				++m_total;
+
+			word = ( word & ~( slot_mask << shift ) ) |
+				( static_cast< unsigned long long >( outcome ) << shift );
+			++m_counts[ outcome ];
+
+			next_pointer();
+		}
+
+		//! Get count of events with the outcome.
+		unsigned int
+		count( OUTCOME what ) const
+		{
+			return m_counts[ index( what ) ];
+		}
+
+		//! Total count of happened events.
+		unsigned int
+		total() const
+		{
+			return m_total;
+		}
+
+		//! Get percentage value of events with the outcome.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		share( OUTCOME what ) const
+		{
+			const unsigned int events = count( what );
+
+			if ( m_total == 0 )
+				return 0;
+
+			return events * 100.0 / m_total;
+		}
+
+	private:
+		//! Bits of one event in the buffer.
+		static const unsigned int slot_bits = OUTCOMES <= 4 ? 2 : 4;
+
+		//! Count of events in one word of the buffer.
+		static const unsigned int slots_per_word = 64 / slot_bits;
+
+		//! Mask of one event.
+		static const unsigned long long slot_mask = ( 1ULL << slot_bits ) - 1;
+
+		//! Number of the outcome.
+		/*!
+			Throws if the outcome is out of [0, OUTCOMES).
+		*/
+		static unsigned int
+		index( OUTCOME what )
+		{
+			const unsigned int outcome = static_cast< unsigned int >( what );
+			if ( outcome >= OUTCOMES )
+				throw std::runtime_error(
+					"Outcome out of range is detected at outcome_counter. "
+					"Must be less than OUTCOMES." );
+
+			return outcome;
+		}
+
+		//! Moves pointer to the next event.
+		void
+		next_pointer()
+		{
+			if ( m_pointer == 0 )
+				m_pointer = m_number - 1;
+			else
+				--m_pointer;
+		}
+
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Counts of events by outcomes.
+		unsigned int m_counts[ OUTCOMES ];
+
+		//! Total count of happened events.
+		unsigned int m_total;
+
+		//! Pointer to the moving through buffer.
+		//! Point out to the element which will be changed next time.
+		unsigned int m_pointer;
+
+		//! Saves outcomes of all (N) previous events.
+		std::vector< unsigned long long > m_store;
+
+		ACE_Mutex m_store_locker;
+};
+
+} /* namespace tds */
+
+#endif
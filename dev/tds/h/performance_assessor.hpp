@@ -37,10 +37,14 @@
 
 #include <ace/Date_Time.h>
 
-#include <deque>
+#include <tds/h/clock.hpp>
+#include <tds/h/ring_buffer.hpp>
+#include <tds/h/time_buckets.hpp>
 
 #include <gtest/gtest_prod.h>
 
+#include <tds/h/seqlock.hpp>
+
 namespace tds {
 
 namespace performance_assessor {
@@ -49,7 +53,8 @@ namespace performance_assessor {
 enum performance_assessor_type_t
 {
 	dummy,
-	simple
+	simple,
+	bucketed
 };
 
 };
@@ -62,20 +67,41 @@ struct executed_task_t
 	//!   (  ,  ).
 	unsigned int m_size;
 
-	explicit executed_task_t( unsigned int size ) : 
-		m_size( size ), 
-		m_time_in( ACE_OS::gettimeofday() )
+	executed_task_t( unsigned int size, const ACE_Time_Value & time ) : 
+		m_time_in( time ),
+		m_size( size )
 	{}
 
 	explicit executed_task_t( const ACE_Time_Value & time ) : 
-		m_size( 0 ), 
-		m_time_in( time )
+		m_time_in( time ),
+		m_size( 0 )
 	{}
 };
 
 bool
 operator < (const executed_task_t & left, const executed_task_t & right);
 
+//!   assessor'    .
+struct performance_assessor_snapshot_t
+{
+	//!   .
+	unsigned long long m_tasks;
+	//!      .
+	unsigned long long m_sum_size;
+
+	//!    .
+	float m_assess_performance_in_tasks;
+	//!    .
+	float m_assess_performance_in_size;
+
+	//!    assessor' ( , , ...).
+	/*!
+		  ,  .
+	*/
+	performance_assessor_snapshot_t &
+	merge( const performance_assessor_snapshot_t & other );
+};
+
 //!   assessor'.
 class performance_assessor_interface_t
 {
@@ -104,6 +130,13 @@ class performance_assessor_interface_t
 		//!    .
 		virtual bool
 		active() const = 0;
+
+		//!   .
+		/*!
+			    ,   .
+		*/
+		virtual performance_assessor_snapshot_t
+		snapshot() const = 0;
 };
 
 //!       
@@ -116,7 +149,9 @@ class performance_assessor_t : public performance_assessor_interface_t
 			//!   (  ).
 			unsigned int period_analysis,
 			//!    .
-			unsigned int power = 1 );
+			unsigned int power = 1,
+			//!  .
+			const clock_interface_t & clock = default_clock() );
 
 		virtual void
 		add( 
@@ -134,6 +169,9 @@ class performance_assessor_t : public performance_assessor_interface_t
 		virtual bool
 		active() const;
 
+		virtual performance_assessor_snapshot_t
+		snapshot() const;
+
 	private:
 		FRIEND_TEST( PerformanceAssessor, TimeLowerBound );
 
@@ -141,7 +179,12 @@ class performance_assessor_t : public performance_assessor_interface_t
 		void
 		assess();
 
-		typedef std::deque< executed_task_t > executed_tasks_t;
+		//!    .
+		void
+		publish();
+
+		//!  :      .
+		typedef ring_buffer_t< executed_task_t > executed_tasks_t;
 
 		//!   .
 		executed_tasks_t m_executed_tasks;
@@ -152,6 +195,9 @@ class performance_assessor_t : public performance_assessor_interface_t
 		//!   (  , ).
 		const unsigned int m_period_analysis;
 
+		//!  .
+		const clock_interface_t & m_clock;
+
 		//!     .
 		float m_assess_performance_in_tasks;
 		//!     .
@@ -177,6 +223,134 @@ class performance_assessor_t : public performance_assessor_interface_t
 			    power.
 		*/
 		unsigned int m_power_outgoing_counter;
+
+		//!   .
+		seqlock_t< performance_assessor_snapshot_t > m_snapshot;
+};
+
+//!      .
+/*!
+	  :     ,
+	       .
+	 O(),     , 
+	    O( ).
+
+	  power  ,   performance_assessor_t:
+	  power   power  .
+	       
+	(period_analysis / buckets).
+	period_analysis    buckets  .
+*/
+class performance_assessor_bucketed_t : public performance_assessor_interface_t
+{
+	public:
+
+		performance_assessor_bucketed_t( 
+			//!   (  ).
+			unsigned int period_analysis,
+			//!    .
+			unsigned int power = 1,
+			//!     .
+			unsigned int buckets = 10,
+			//!  .
+			const clock_interface_t & clock = default_clock() );
+
+		virtual void
+		add( 
+			unsigned int size );
+
+		virtual void
+		cleanup();
+
+		virtual float
+		get_assess_performance_in_size() const;
+
+		virtual float
+		get_assess_performance_in_tasks() const;
+
+		virtual bool
+		active() const;
+
+		virtual performance_assessor_snapshot_t
+		snapshot() const;
+
+	private:
+		//!   .
+		struct bucket_t
+		{
+			//!  .
+			unsigned long long m_tasks;
+			//!   .
+			unsigned long long m_sum_size;
+
+			bucket_t() :
+				m_tasks( 0 ), m_sum_size( 0 )
+			{}
+
+			bucket_t &
+			operator += ( const bucket_t & other )
+			{
+				m_tasks += other.m_tasks;
+				m_sum_size += other.m_sum_size;
+				return *this;
+			}
+
+			bucket_t &
+			operator -= ( const bucket_t & other )
+			{
+				m_tasks -= other.m_tasks;
+				m_sum_size -= other.m_sum_size;
+				return *this;
+			}
+		};
+
+		//!  :      .
+		bucket_t
+		kept() const;
+
+		//!    .
+		void
+		assess();
+
+		//!    .
+		void
+		publish();
+
+		//!   (  , ).
+		const unsigned int m_period_analysis;
+
+		//!  .
+		const clock_interface_t & m_clock;
+
+		//!   .
+		time_buckets_t< bucket_t > m_buckets;
+
+		//!     .
+		float m_assess_performance_in_tasks;
+		//!     .
+		float m_assess_performance_in_size;
+
+		//!   .
+		const unsigned int m_power;
+
+		//!   power'.
+		unsigned int m_power_pool_counter;
+
+		//!   power'.
+		/*!
+			     .
+		*/
+		unsigned long long m_power_outgoing_counter;
+
+		//!  ,    add().
+		/*!
+			  cleanup(),   performance_assessor_t,
+			  cleanup()   m_power_outgoing_counter.
+		*/
+		bucket_t m_expired;
+
+		//!   .
+		seqlock_t< performance_assessor_snapshot_t > m_snapshot;
 };
 
 //!      0.
@@ -197,6 +371,9 @@ class performance_assessor_dummy_t : public performance_assessor_interface_t
 
 		virtual bool
 		active() const;
+
+		virtual performance_assessor_snapshot_t
+		snapshot() const;
 };
 
 performance_assessor_interface_t *
@@ -204,7 +381,10 @@ performance_assessor_factory(
 	const performance_assessor::performance_assessor_type_t & 
 		performance_assessor_type,
 	unsigned int period_analysis,
-	unsigned int assess_power );
+	unsigned int assess_power,
+	const clock_interface_t & clock = default_clock(),
+	//!   ( performance_assessor::bucketed).
+	unsigned int buckets = 10 );
 
 } /* namespace tds */
 
@@ -37,10 +37,14 @@
 
 #include <ace/Date_Time.h>
 
-#include <deque>
+#include <tds/h/clock.hpp>
+#include <tds/h/ring_buffer.hpp>
+#include <tds/h/time_buckets.hpp>
 
 #include <gtest/gtest_prod.h>
 
+#include <tds/h/seqlock.hpp>
+
 namespace tds {
 
 namespace performance_estimator {
@@ -49,7 +53,8 @@ namespace performance_estimator {
 enum performance_estimator_type_t
 {
 	dummy,
-	simple
+	simple,
+	bucketed
 };
 
 };
@@ -67,22 +72,48 @@ struct solved_task_t
 	//!   (  ,  ).
 	unsigned int m_size;
 
-	solved_task_t( unsigned int time_in_progress, unsigned int size ) : 
-		m_size( size ), 
+	solved_task_t( 
+		unsigned int time_in_progress, 
+		unsigned int size, 
+		const ACE_Time_Value & time ) : 
+		m_time_in( time ),
 		m_time_in_progress( time_in_progress ),
-		m_time_in( ACE_OS::gettimeofday() )
+		m_size( size )
 	{}
 
 	explicit solved_task_t( const ACE_Time_Value & time ) : 
-		m_size( 0 ), 
+		m_time_in( time ),
 		m_time_in_progress( 0 ),
-		m_time_in( time )
+		m_size( 0 )
 	{}
 };
 
 bool
 operator < (const solved_task_t & left, const solved_task_t & right);
 
+//!   estimator'    .
+struct performance_estimator_snapshot_t
+{
+	//!   .
+	unsigned long long m_tasks;
+	//!     .
+	unsigned long long m_sum_time_in_progress;
+	//!     .
+	unsigned long long m_sum_size;
+
+	//!    .
+	float m_estimate_performance_in_tasks;
+	//!    .
+	float m_estimate_performance_in_size;
+
+	//!    estimator' ( , , ...).
+	/*!
+		     .
+	*/
+	performance_estimator_snapshot_t &
+	merge( const performance_estimator_snapshot_t & other );
+};
+
 //!   estimator'.
 class performance_estimator_interface_t
 {
@@ -113,6 +144,13 @@ class performance_estimator_interface_t
 		//!   .
 		virtual bool
 		active() const = 0;
+
+		//!   .
+		/*!
+			    ,   .
+		*/
+		virtual performance_estimator_snapshot_t
+		snapshot() const = 0;
 };
 
 //!      
@@ -127,7 +165,9 @@ class performance_estimator_t : public performance_estimator_interface_t
 			//!     .
 			float start_estimate_performance_in_tasks,
 			//!     .
-			float start_estimate_performance_in_size );
+			float start_estimate_performance_in_size,
+			//!  .
+			const clock_interface_t & clock = default_clock() );
 
 		virtual void
 		add( 
@@ -145,6 +185,9 @@ class performance_estimator_t : public performance_estimator_interface_t
 
 		virtual bool
 		active() const;
+
+		virtual performance_estimator_snapshot_t
+		snapshot() const;
 	private:
 		FRIEND_TEST( PerformanceEstimator, TimeLowerBound );
 
@@ -152,7 +195,12 @@ class performance_estimator_t : public performance_estimator_interface_t
 		void
 		estimate();
 
-		typedef std::deque< solved_task_t > solved_tasks_t;
+		//!    .
+		void
+		publish();
+
+		//!  :      .
+		typedef ring_buffer_t< solved_task_t > solved_tasks_t;
 
 		//!    .
 		solved_tasks_t m_solved_tasks;
@@ -165,10 +213,119 @@ class performance_estimator_t : public performance_estimator_interface_t
 		//!   (  , ).
 		const unsigned int m_period_analysis;
 
+		//!  .
+		const clock_interface_t & m_clock;
+
+		//!     .
+		float m_estimate_performance_in_tasks;
+		//!     .
+		float m_estimate_performance_in_size;
+
+		//!   .
+		seqlock_t< performance_estimator_snapshot_t > m_snapshot;
+};
+
+//!     .
+/*!
+	  :     ,
+	    ,    
+	.  O(),     ,
+	cleanup()  O( ).
+
+	  ,   performance_estimator_t,  
+	    (period_analysis / buckets).
+	period_analysis    buckets  .
+*/
+class performance_estimator_bucketed_t : public performance_estimator_interface_t
+{
+	public:
+
+		performance_estimator_bucketed_t( 
+			//!   (  ).
+			unsigned int period_analysis,
+			//!     .
+			float start_estimate_performance_in_tasks,
+			//!     .
+			float start_estimate_performance_in_size,
+			//!     .
+			unsigned int buckets = 10,
+			//!  .
+			const clock_interface_t & clock = default_clock() );
+
+		virtual void
+		add( 
+			unsigned int time_in_progress, 
+			unsigned int size );
+
+		virtual void
+		cleanup();
+
+		virtual float
+		get_estimate_performance_in_size() const;
+
+		virtual float
+		get_estimate_performance_in_tasks() const;
+
+		virtual bool
+		active() const;
+
+		virtual performance_estimator_snapshot_t
+		snapshot() const;
+	private:
+		//!   .
+		struct bucket_t
+		{
+			//!  .
+			unsigned long long m_tasks;
+			//!    .
+			unsigned long long m_sum_time_in_progress;
+			//!   .
+			unsigned long long m_sum_size;
+
+			bucket_t() :
+				m_tasks( 0 ), m_sum_time_in_progress( 0 ), m_sum_size( 0 )
+			{}
+
+			bucket_t &
+			operator += ( const bucket_t & other )
+			{
+				m_tasks += other.m_tasks;
+				m_sum_time_in_progress += other.m_sum_time_in_progress;
+				m_sum_size += other.m_sum_size;
+				return *this;
+			}
+
+			bucket_t &
+			operator -= ( const bucket_t & other )
+			{
+				m_tasks -= other.m_tasks;
+				m_sum_time_in_progress -= other.m_sum_time_in_progress;
+				m_sum_size -= other.m_sum_size;
+				return *this;
+			}
+		};
+
+		//!    .
+		void
+		estimate();
+
+		//!    .
+		void
+		publish();
+
+		//!  .
+		const clock_interface_t & m_clock;
+
+		//!   .
+		time_buckets_t< bucket_t > m_buckets;
+
 		//!     .
 		float m_estimate_performance_in_tasks;
 		//!     .
 		float m_estimate_performance_in_size;
+
+		//!   .
+		seqlock_t< performance_estimator_snapshot_t > m_snapshot;
 };
 
 //!   .
@@ -190,6 +347,9 @@ class performance_estimator_dummy_t : public performance_estimator_interface_t
 
 		virtual bool
 		active() const;
+
+		virtual performance_estimator_snapshot_t
+		snapshot() const;
 };
 
 performance_estimator_interface_t *
@@ -198,7 +358,10 @@ performance_estimator_factory(
 		performance_estimator_type,
 	unsigned int period_analysis,
 	float start_estimate_performance_in_tasks,
-	float start_estimate_performance_in_size );
+	float start_estimate_performance_in_size,
+	const clock_interface_t & clock = default_clock(),
+	//!   ( performance_estimator::bucketed).
+	unsigned int buckets = 10 );
 
 } /* namespace tds */
 
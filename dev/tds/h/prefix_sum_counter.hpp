@@ -0,0 +1,113 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__PREFIX_SUM_COUNTER_HPP__INCLUDED )
+#define _TDS__PREFIX_SUM_COUNTER_HPP__INCLUDED
+
+#include <vector>
+
+namespace tds {
+
+//! Counts sums of special number events over several last-k windows.
+/*!
+	Stores running sums of last N events, no more, and answers
+	sums of last k events for any k <= N from the same buffer
+	(10, 100 and 1000 last events from one counter).
+
+	Buffer keeps the running sum of all events after each event,
+	so the sum of last k events is the difference of two running
+	sums: event(), sum_last() and mean_last() are O(1).
+	Running sums are wrapped by modulo 2^64, the difference is exact
+	while the sum of the window fits into 64 bits.
+
+	Not thread-safe.
+*/
+class prefix_sum_counter_t
+{
+	public:
+		prefix_sum_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number );
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( unsigned long long value );
+
+		//! Get sum of last k events.
+		/*!
+			k is limited by total().
+		*/
+		unsigned long long
+		sum_last( unsigned int k ) const;
+
+		//! Get arithmetic mean of last k events.
+		/*!
+			k is limited by total().
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		mean_last( unsigned int k ) const;
+
+		//! Get sum of all (N) last events.
+		unsigned long long
+		sum() const;
+
+		//! Get arithmetic mean of all (N) last events.
+		float
+		mean() const;
+
+		//! Total counted events.
+		unsigned int
+		total() const;
+
+	private:
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Count of all happened events.
+		unsigned long long m_events;
+
+		//! Running sums after 0, 1, 2, ... events.
+		/*!
+			Running sum after e events is at e % (N + 1).
+		*/
+		std::vector< unsigned long long > m_store;
+};
+
+} /* namespace tds */
+
+#endif
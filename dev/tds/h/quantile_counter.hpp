@@ -0,0 +1,129 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__QUANTILE_COUNTER_HPP__INCLUDED )
+#define _TDS__QUANTILE_COUNTER_HPP__INCLUDED
+
+#include <vector>
+
+namespace tds {
+
+//! Counts quantiles of special number events (latency, size, ... ).
+/*!
+	Stores values of last N events, no more, the same window
+	as sum_counter_t has.
+
+	Values are counted in buckets of the given width from 0 to
+	max_value, values above max_value are counted as max_value.
+	Counts of the buckets are kept in the Fenwick tree, so event()
+	and quantile() are O(log(max_value / bucket_width)) and
+	do not depend on N.
+
+	With bucket width 1 quantiles are exact.
+
+	Not thread-safe.
+*/
+class quantile_counter_t
+{
+	public:
+		quantile_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number,
+			//! Maximum value which is distinguished.
+			unsigned int max_value,
+			//! Width of the bucket of values.
+			unsigned int bucket_width = 1 );
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( unsigned int value );
+
+		//! Get quantile of the values.
+		/*!
+			q - from 0 to 1 (0.99 for p99).
+
+			Returns the least value which is not less than q * total()
+			values (nearest-rank), up to the end of its bucket.
+			If there were 0 events, result of this function will be 0.
+		*/
+		unsigned int
+		quantile( float q ) const;
+
+		//! Total counted events.
+		unsigned int
+		total() const;
+
+	private:
+
+		//! Adds delta to the count of the bucket.
+		void
+		add( unsigned int bucket, int delta );
+
+		//! Bucket which contains the event with given rank (from 1).
+		unsigned int
+		find( unsigned int rank ) const;
+
+		//! Moves pointer to the next event.
+		void
+		next_pointer();
+
+		//! Maximum value which is distinguished.
+		const unsigned int m_max_value;
+
+		//! Width of the bucket of values.
+		const unsigned int m_bucket_width;
+
+		//! Total counted events.
+		unsigned int m_total;
+
+		//! Pointer to the moving through buffer.
+		//! Point out to the element which will be changed next time.
+		unsigned int m_pointer;
+
+		//! Saves buckets of all (N) previous events.
+		std::vector< unsigned int > m_store;
+
+		//! Fenwick tree of counts of buckets (from 1).
+		std::vector< unsigned int > m_tree;
+
+		//! Highest power of two which is not more than count of buckets.
+		unsigned int m_top;
+};
+
+} /* namespace tds */
+
+#endif
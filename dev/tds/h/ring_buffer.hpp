@@ -0,0 +1,189 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__RING_BUFFER_HPP__INCLUDED )
+#define _TDS__RING_BUFFER_HPP__INCLUDED
+
+#include <algorithm>
+#include <vector>
+
+namespace tds {
+
+//! Queue in the ring of the preallocated buffer.
+/*!
+	Capacity is a power of two, position of the element is taken
+	by mask. Buffer grows twice when it is full and is never shrunk,
+	so in the steady state push_back() and pop_front() do not
+	touch the allocator.
+
+	Elements are stored in no more than two contiguous segments
+	(from the head to the end of the buffer and from the beginning
+	of the buffer), so sorted elements can be searched by
+	std::lower_bound segment by segment.
+
+	Not thread-safe.
+*/
+template< typename VALUE >
+class ring_buffer_t
+{
+	public:
+		typedef typename std::vector< VALUE >::size_type size_type;
+
+		ring_buffer_t() :
+			m_head( 0 ), m_size( 0 )
+		{}
+
+		//! Adds the value to the end.
+		void
+		push_back( const VALUE & value )
+		{
+			if ( m_size == m_store.size() )
+				grow( value );
+
+			m_store[ ( m_head + m_size ) & ( m_store.size() - 1 ) ] = value;
+			++m_size;
+		}
+
+		//! Removes count values from the beginning.
+		void
+		pop_front( size_type count )
+		{
+			if ( count > m_size )
+				count = m_size;
+
+			if ( count == 0 )
+				return;
+
+			m_head = ( m_head + count ) & ( m_store.size() - 1 );
+			m_size -= count;
+		}
+
+		//! Value by index from the beginning.
+		const VALUE &
+		operator[]( size_type index ) const
+		{
+			return m_store[ ( m_head + index ) & ( m_store.size() - 1 ) ];
+		}
+
+		//! The first value.
+		const VALUE &
+		front() const
+		{
+			return m_store[ m_head ];
+		}
+
+		//! The last value.
+		const VALUE &
+		back() const
+		{
+			return ( *this )[ m_size - 1 ];
+		}
+
+		//! Count of values.
+		size_type
+		size() const
+		{
+			return m_size;
+		}
+
+		bool
+		empty() const
+		{
+			return m_size == 0;
+		}
+
+		//! Size of the buffer.
+		size_type
+		capacity() const
+		{
+			return m_store.size();
+		}
+
+		//! Index of the first value which is not less than the given one.
+		/*!
+			Values must be sorted by operator<.
+		*/
+		size_type
+		lower_bound( const VALUE & value ) const
+		{
+			if ( m_size == 0 )
+				return 0;
+
+			const size_type first_size =
+				std::min( m_size, m_store.size() - m_head );
+			const VALUE * first = &m_store[ m_head ];
+
+			if ( first_size == m_size || !( first[ first_size - 1 ] < value ) )
+				return std::lower_bound( first, first + first_size, value ) - first;
+
+			const VALUE * second = &m_store[0];
+			return first_size + ( std::lower_bound(
+				second, second + ( m_size - first_size ), value ) - second );
+		}
+
+	private:
+		//! Doubles the buffer.
+		/*!
+			New positions are filled by the value, it is
+			overwritten by push_back() anyway.
+		*/
+		void
+		grow( const VALUE & value )
+		{
+			std::vector< VALUE > store(
+				m_store.empty() ? initial_capacity : m_store.size() * 2, value );
+
+			for( size_type i = 0; i < m_size; ++i )
+				store[i] = ( *this )[i];
+
+			m_store.swap( store );
+			m_head = 0;
+		}
+
+		//! Capacity of the first allocation.
+		static const size_type initial_capacity = 16;
+
+		//! Buffer, size is a power of two.
+		std::vector< VALUE > m_store;
+
+		//! Position of the first value.
+		size_type m_head;
+
+		//! Count of values.
+		size_type m_size;
+};
+
+} /* namespace tds */
+
+#endif
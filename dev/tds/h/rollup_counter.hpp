@@ -0,0 +1,106 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__ROLLUP_COUNTER_HPP__INCLUDED )
+#define _TDS__ROLLUP_COUNTER_HPP__INCLUDED
+
+#include <tds/h/prefix_sum_counter.hpp>
+
+#include <vector>
+
+namespace tds {
+
+//! Counts sums of special number events at several resolutions.
+/*!
+	Levels are windows of buckets: { 60, 60, 24 } is 60 seconds,
+	60 minutes and 24 hours. Every event is one closed bucket of
+	the first level (sum of the traffic of the second, ... ).
+	When a level gets as many buckets as its size, their sum becomes
+	one closed bucket of the next level.
+
+	Memory is fixed: one prefix_sum_counter_t per level. sum() and
+	mean() are O(1), event() is O(1) per level which is fed.
+
+	Not thread-safe.
+*/
+class rollup_counter_t
+{
+	public:
+		rollup_counter_t(
+			//! Count of buckets of the levels, from the finest one.
+			const std::vector< unsigned int > & levels );
+
+		//! Bucket of the first level is closed.
+		/*!
+			value - sum of the bucket.
+		*/
+		void
+		event( unsigned long long value );
+
+		//! Get sum of last k closed buckets of the level.
+		/*!
+			k is limited by total( level ).
+		*/
+		unsigned long long
+		sum( unsigned int level, unsigned int k ) const;
+
+		//! Get arithmetic mean of last k closed buckets of the level.
+		/*!
+			If there were 0 buckets, result of this function will be 0.
+		*/
+		float
+		mean( unsigned int level, unsigned int k ) const;
+
+		//! Count of closed buckets of the level under control.
+		unsigned int
+		total( unsigned int level ) const;
+
+		//! Count of levels.
+		unsigned int
+		levels() const;
+
+	private:
+		//! Buckets of the levels.
+		std::vector< prefix_sum_counter_t > m_levels;
+
+		//! Sizes of the levels.
+		std::vector< unsigned int > m_sizes;
+
+		//! Count of buckets of the level since the last feeding of the next level.
+		std::vector< unsigned int > m_pending;
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,154 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__SEQLOCK_HPP__INCLUDED )
+#define _TDS__SEQLOCK_HPP__INCLUDED
+
+#include <atomic>
+#include <cstring>
+
+namespace tds {
+
+//! Value which is published by one writer and read by many readers.
+/*!
+	Sequence lock: writer makes the sequence odd, stores the value and
+	makes the sequence even again. Reader copies the value and retries
+	if the sequence was odd or was changed during the copy.
+
+	Readers never block the writer and never see a mixed value.
+	Writer never waits for readers. Reader can spin while the writer
+	is storing, it is a few words long.
+
+	Value is kept as atomic words, so concurrent copy is not a data race.
+	Copy of the seqlock is the copy of the last published value
+	(loaded from the source, stored into the destination).
+
+	VALUE must be trivially copyable (POD).
+
+	Thread-safe for one writer at a time (writers must be serialized
+	by the owner) and any count of readers.
+*/
+template< typename VALUE >
+class seqlock_t
+{
+	public:
+		seqlock_t() :
+			m_sequence( 0 )
+		{
+			store( VALUE() );
+		}
+
+		explicit seqlock_t( const VALUE & value ) :
+			m_sequence( 0 )
+		{
+			store( value );
+		}
+
+		seqlock_t( const seqlock_t & other ) :
+			m_sequence( 0 )
+		{
+			store( other.load() );
+		}
+
+		seqlock_t &
+		operator = ( const seqlock_t & other )
+		{
+			store( other.load() );
+			return *this;
+		}
+
+		//! Publishes the new value.
+		void
+		store( const VALUE & value )
+		{
+			unsigned long long words[ words_count ] = {};
+			std::memcpy( words, &value, sizeof( VALUE ) );
+
+			const unsigned long long sequence =
+				m_sequence.load( std::memory_order_relaxed );
+
+			m_sequence.store( sequence + 1, std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_release );
+
+			for( unsigned int i = 0; i < words_count; ++i )
+				m_words[i].store( words[i], std::memory_order_relaxed );
+
+			m_sequence.store( sequence + 2, std::memory_order_release );
+		}
+
+		//! Consistent copy of the last published value.
+		VALUE
+		load() const
+		{
+			unsigned long long words[ words_count ];
+
+			for(;;)
+			{
+				const unsigned long long before =
+					m_sequence.load( std::memory_order_acquire );
+
+				for( unsigned int i = 0; i < words_count; ++i )
+					words[i] = m_words[i].load( std::memory_order_relaxed );
+
+				std::atomic_thread_fence( std::memory_order_acquire );
+
+				const unsigned long long after =
+					m_sequence.load( std::memory_order_relaxed );
+
+				if ( before == after && ( before & 1 ) == 0 )
+					break;
+			}
+
+			VALUE value;
+			std::memcpy( &value, words, sizeof( VALUE ) );
+
+			return value;
+		}
+
+	private:
+		//! Count of words for the value.
+		static const unsigned int words_count =
+			( sizeof( VALUE ) + sizeof( unsigned long long ) - 1 ) /
+				sizeof( unsigned long long );
+
+		//! Sequence of the value, odd while writer is storing.
+		std::atomic< unsigned long long > m_sequence;
+
+		//! Value by words.
+		std::atomic< unsigned long long > m_words[ words_count ];
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,152 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__SHARDED_EVENT_COUNTER_HPP__INCLUDED )
+#define _TDS__SHARDED_EVENT_COUNTER_HPP__INCLUDED
+
+#include <atomic>
+#include <vector>
+
+namespace tds {
+
+//! Counts facts that events already happened, sharded by writers.
+/*!
+	Window of N events is split into shards. Each shard has its own
+	cache lines and stores facts about last events written into it.
+	Every thread writes into its own shard (by current_thread_index()),
+	so writers do not share cache lines while there are enough shards.
+
+	count(), total() and percentage() sum the shards on read, so
+	reading is O(shards) and writing is a few uncontended atomic
+	operations.
+
+	Events are not ordered between shards: the window is the last
+	events of every shard, not strictly the last N events at all.
+
+	Thread-safe.
+*/
+class sharded_event_counter_t
+{
+	public:
+		sharded_event_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number,
+			//! Count of shards.
+			/*!
+				0 - by count of hardware threads.
+				Can't be more than number.
+			*/
+			unsigned int shards = 0 );
+
+		//! Event was happened (true/false).
+		/*!
+			Goes to the shard of the current thread.
+
+			true - positive (happened)
+			false - negative.
+		*/
+		void
+		event( bool what );
+
+		//! Event was happened (true/false) into the given shard.
+		/*!
+			For writers which have their own numbering (by CPU,
+			by worker, ...). Shard is taken by modulo of shards().
+		*/
+		void
+		event( bool what, unsigned int shard );
+
+		//! Get count of true-events.
+		unsigned int
+		count() const;
+
+		//! Total count of happened events.
+		unsigned int
+		total() const;
+
+		//! Get percentage value of true-events.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		percentage() const;
+
+		//! Count of shards.
+		unsigned int
+		shards() const;
+
+	private:
+		typedef std::atomic< unsigned long long > word_t;
+
+		//! Header of shard: sequence number of the next event.
+		static const unsigned int head_word = 0;
+		//! Header of shard: count of true-events (as signed value).
+		static const unsigned int count_word = 1;
+		//! Size of header of shard.
+		static const unsigned int header_words = 2;
+
+		//! Beginning of the shard.
+		word_t *
+		shard_words( unsigned int shard ) const;
+
+		//! Count of maximum events under control by shard.
+		unsigned int
+		shard_number( unsigned int shard ) const;
+
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Count of shards.
+		unsigned int m_shards;
+
+		//! Distance between shards, in words.
+		/*!
+			Header and window of the shard rounded up to
+			the cache line.
+		*/
+		unsigned int m_stride;
+
+		//! Storage of all shards.
+		/*!
+			Is not aligned, m_base points to the first cache line.
+		*/
+		std::vector< word_t > m_store;
+
+		//! First shard (aligned to the cache line).
+		word_t * m_base;
+};
+
+} /* namespace tds */
+
+#endif
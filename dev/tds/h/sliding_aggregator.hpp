@@ -0,0 +1,220 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__SLIDING_AGGREGATOR_HPP__INCLUDED )
+#define _TDS__SLIDING_AGGREGATOR_HPP__INCLUDED
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace tds {
+
+namespace sliding_aggregator {
+
+//! Minimum of two values.
+template< typename VALUE >
+struct min_t
+{
+	VALUE
+	operator()( const VALUE & left, const VALUE & right ) const
+	{
+		return std::min( left, right );
+	}
+};
+
+//! Maximum of two values.
+template< typename VALUE >
+struct max_t
+{
+	VALUE
+	operator()( const VALUE & left, const VALUE & right ) const
+	{
+		return std::max( left, right );
+	}
+};
+
+};
+
+//! Aggregates last N events by an associative operation (min, max, ... ).
+/*!
+	Stores values of last N events, no more, and gives
+	value1 op value2 op .. op valueN (from the oldest to the newest).
+
+	OPERATION must be associative, commutativity is not required:
+	std::bit_or, sliding_aggregator::min_t, sliding_aggregator::max_t,
+	operations on user structs.
+
+	Events are split into blocks of N/2 events. The window is a suffix
+	of an old block, at most one whole block and a prefix of the current
+	block. Prefix of the current block and aggregates of whole blocks are
+	kept on the way. Suffixes of the previous block are computed one per
+	event, while the current block is filled, and are ready before the
+	block becomes the oldest one. So event() and aggregate() take
+	no more than a few operations each, there is no rescan of the window.
+
+	Not thread-safe.
+*/
+template< typename VALUE, typename OPERATION >
+class sliding_aggregator_t
+{
+	public:
+		sliding_aggregator_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number,
+			//! Operation.
+			const OPERATION & operation = OPERATION() ) :
+			m_number( number ),
+			m_block( std::max( number / 2, 1U ) ),
+			m_events( 0 ),
+			m_operation( operation ),
+			m_prefix(),
+			m_values( blocks * m_block ),
+			m_suffixes( blocks * m_block ),
+			m_aggregates( blocks )
+		{
+			if ( number == 0 )
+				throw std::runtime_error(
+					"Null number is detected at sliding_aggregator c'tor. Must be more than 0." );
+		}
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( const VALUE & value )
+		{
+			const unsigned long long block = m_events / m_block;
+			const unsigned int position = m_events % m_block;
+			const unsigned int slot = block % blocks;
+
+			if ( position == 0 )
+				m_prefix = value;
+			else
+				m_prefix = m_operation( m_prefix, value );
+
+			m_values[ slot * m_block + position ] = value;
+
+			// One more suffix of the previous block.
+			if ( block != 0 )
+			{
+				const unsigned int previous = ( block - 1 ) % blocks * m_block;
+				const unsigned int index = m_block - 1 - position;
+
+				if ( index == m_block - 1 )
+					m_suffixes[ previous + index ] = m_values[ previous + index ];
+				else
+					m_suffixes[ previous + index ] = m_operation(
+						m_values[ previous + index ], m_suffixes[ previous + index + 1 ] );
+			}
+
+			if ( position == m_block - 1 )
+				m_aggregates[ slot ] = m_prefix;
+
+			++m_events;
+		}
+
+		//! Get aggregate of the events (from the oldest to the newest).
+		/*!
+			If there were 0 events, result of this function will be VALUE().
+		*/
+		VALUE
+		aggregate() const
+		{
+			if ( m_events == 0 )
+				return VALUE();
+
+			const unsigned long long current = ( m_events - 1 ) / m_block;
+			const unsigned long long first =
+				m_events > m_number ? m_events - m_number : 0;
+			const unsigned long long oldest = first / m_block;
+
+			if ( oldest == current )
+				return m_prefix;
+
+			const unsigned int offset = first % m_block;
+			VALUE result = offset == 0 ?
+				m_aggregates[ oldest % blocks ] :
+				m_suffixes[ oldest % blocks * m_block + offset ];
+
+			for( unsigned long long block = oldest + 1; block != current; ++block )
+				result = m_operation( result, m_aggregates[ block % blocks ] );
+
+			return m_operation( result, m_prefix );
+		}
+
+		//! Total counted events.
+		unsigned int
+		total() const
+		{
+			return m_events < m_number ? m_events : m_number;
+		}
+
+	private:
+		//! Count of blocks in the buffer.
+		/*!
+			Window touches no more than 3 blocks, one more block
+			is the oldest one which is being overwritten.
+		*/
+		static const unsigned int blocks = 4;
+
+		//! Count of maximum events under control.
+		const unsigned int m_number;
+
+		//! Count of events in one block.
+		const unsigned int m_block;
+
+		//! Count of all happened events.
+		unsigned long long m_events;
+
+		//! Operation.
+		OPERATION m_operation;
+
+		//! Aggregate of the current block from its beginning.
+		VALUE m_prefix;
+
+		//! Values of the blocks.
+		std::vector< VALUE > m_values;
+
+		//! Aggregates of the blocks from the value to the end of the block.
+		std::vector< VALUE > m_suffixes;
+
+		//! Aggregates of the whole blocks.
+		std::vector< VALUE > m_aggregates;
+};
+
+} /* namespace tds */
+
+#endif
@@ -35,53 +35,289 @@
 #if !defined( _TDS__SUM_COUNTER_HPP__INCLUDED )
 #define _TDS__SUM_COUNTER_HPP__INCLUDED
 
+#include <algorithm>
 #include <vector>
+#include <stdexcept>
+
+#include <tds/h/compensated_sum.hpp>
+#include <tds/h/seqlock.hpp>
+#include <tds/h/window_policy.hpp>
 
 namespace tds {
 
+//! Consistent state of basic_sum_counter_t.
+template< typename SUM >
+struct basic_sum_counter_snapshot_t
+{
+	//! Sum of happened events.
+	SUM m_sum;
+
+	//! Total counted events.
+	unsigned int m_total;
+
+	//! Get arithmetic mean.
+	float
+	mean() const
+	{
+		if ( m_total == 0 )
+			return 0;
+
+		return static_cast<float>( m_sum ) / m_total;
+	}
+
+	//! Adds events of the other counter (other shard, thread, ... ).
+	basic_sum_counter_snapshot_t &
+	merge( const basic_sum_counter_snapshot_t & other )
+	{
+		m_sum += other.m_sum;
+		m_total += other.m_total;
+
+		return *this;
+	}
+};
+
 //! Counts sums of special number events (traffic, middle value, ... ) 
 /*!
 	Stores sums about last N events, no more.
 
-	Not thread-safe.
+	VALUE is the type of the stored values, ACCUMULATOR is the type
+	of the sum. Narrow VALUE saves memory of the window, wide ACCUMULATOR
+	does not wrap: unsigned short values with unsigned long long sum,
+	double values with compensated_sum_t< double > sum, ... 
+	ACCUMULATOR must have operator+= and operator-= for VALUE.
+
+	WINDOW is the policy of the window (see window_policy):
+	sliding (by default), tumbling or hopping.
+
+	Not thread-safe. But snapshot() can be taken from any thread
+	while one thread writes events.
 */
-class sum_counter_t
+template< typename VALUE, typename ACCUMULATOR, 
+	typename WINDOW = window_policy::sliding_t >
+class basic_sum_counter_t
 {
 	public:
-		sum_counter_t( 
+		//! Type of the sum.
+		typedef typename accumulator_traits_t< ACCUMULATOR >::value_type sum_type;
+
+		//! Consistent state of the counter.
+		typedef basic_sum_counter_snapshot_t< sum_type > snapshot_type;
+
+		basic_sum_counter_t( 
 			//! Count of maximum events under control (buffer size).
-			unsigned int number );
+			unsigned int number,
+			//! Policy of the window.
+			const WINDOW & window = WINDOW() ) : 
+			m_number( number ), m_window( window ),
+			m_sum(), m_total( 0 ), m_pointer( 0 ),
+			m_store( WINDOW::evicts ? number : 0, VALUE() ),
+			m_report()
+		{
+			if (number == 0)
+				throw std::runtime_error( "Null number is detected at sum_counter c'tor. Must be more than 0." );
+		}
 
 		//! Event was happened (true/false).
 		/*!
 			value - number which describes the event.
 		*/
 		void
-		event( unsigned int value );
+		event( VALUE value )
+		{
+			if ( !WINDOW::evicts )
+			{
+				if ( m_window.restart( m_total, m_number ) )
+					restart();
+
+				m_sum += value;
+				++m_total;
+				publish( 1 );
+				return;
+			}
+
+			// Change had place or not?
+			if ( m_store[m_pointer] != value )
+			{
+				m_sum += value;
+				m_sum -= m_store[m_pointer];
+				m_store[m_pointer] = value;
+			}
+
+			next_pointer();
+			publish( 1 );
+		}
+
+		//! Event with the same value was happened n times.
+		/*!
+			Sum of the overwritten values is taken by one pass
+			over the contiguous parts of the buffer.
+		*/
+		void
+		event_n( VALUE value, unsigned int n )
+		{
+			if ( n == 0 )
+				return;
+
+			if ( !WINDOW::evicts )
+			{
+				if ( m_window.restart( m_total, m_number ) )
+					restart();
+
+				if ( m_number - m_total >= n )
+				{
+					m_sum += static_cast< sum_type >( value ) * n;
+					m_total += n;
+				}
+				else
+				{
+					// The last window gets the rest of events.
+					m_total = ( m_total + n - 1 ) % m_number + 1;
+					m_sum = ACCUMULATOR();
+					m_sum += static_cast< sum_type >( value ) * m_total;
+				}
+
+				publish( n );
+				return;
+			}
+
+			const unsigned int number = m_number;
+			const unsigned int pointer = m_pointer;
+
+			if ( n >= number )
+			{
+				// All the buffer is overwritten.
+				std::fill( m_store.begin(), m_store.end(), value );
+				m_sum = ACCUMULATOR();
+				m_sum += static_cast< sum_type >( value ) * number;
+				m_total = number;
+				m_pointer = ( pointer + number - n % number ) % number;
+				publish( n );
+				return;
+			}
+
+			// Events take pointer, pointer - 1, ... with wrap-around.
+			if ( n <= pointer + 1 )
+				fill_span( pointer + 1 - n, pointer + 1, value );
+			else
+			{
+				fill_span( 0, pointer + 1, value );
+				fill_span( number - ( n - pointer - 1 ), number, value );
+			}
+
+			m_sum += static_cast< sum_type >( value ) * n;
+			m_pointer = ( pointer + number - n ) % number;
+
+			if ( number - m_total > n )
+				m_total += n;
+			else
+				m_total = number;
+
+			publish( n );
+		}
+
+		//! Events of the range were happened (in order of the range).
+		template< typename ITERATOR >
+		void
+		events( ITERATOR first, ITERATOR last )
+		{
+			for( ; first != last; ++first )
+				event( *first );
+		}
 
 		//! Get sum of happened events.
-		unsigned int 
-		sum() const;
+		/*!
+			Sum of the last reported window.
+		*/
+		sum_type 
+		sum() const
+		{
+			return m_report.m_sum;
+		}
 
 		//! Total counted events.
 		unsigned int 
-		total() const;
+		total() const
+		{
+			return m_report.m_total;
+		}
 
 		//! Get arithmetic mean.
 		/*!
 			(value1 + value2 + .. + valueN) / N
 		*/
 		float
-		mean() const;
+		mean() const
+		{
+			return m_report.mean();
+		}
+
+		//! Get sum and total of the same moment.
+		/*!
+			Can be called from any thread, never blocks the writer.
+		*/
+		snapshot_type
+		snapshot() const
+		{
+			return m_snapshot.load();
+		}
 
 	private:
 
+		//! Reports sum and total after n events if the window allows it.
+		void
+		publish( unsigned int n )
+		{
+			if ( !m_window.report( n ) )
+				return;
+
+			m_report.m_sum = m_sum;
+			m_report.m_total = m_total;
+			m_snapshot.store( m_report );
+		}
+
+		//! Starts the window from scratch.
+		void
+		restart()
+		{
+			m_sum = ACCUMULATOR();
+			m_total = 0;
+		}
+
 		//! Moves pointer to the next event.
 		void
-		next_pointer();
+		next_pointer()
+		{
+			if ( m_pointer == 0 )
+				m_pointer = m_number - 1;
+			else
+				--m_pointer;
+
+			if ( m_total < m_number ) 
+				++m_total;
+		}
+
+		//! Fills the buffer at [from, to) by the value.
+		/*!
+			Values which were overwritten are subtracted from the sum.
+		*/
+		void
+		fill_span( unsigned int from, unsigned int to, VALUE value )
+		{
+			for( unsigned int i = from; i < to; ++i )
+			{
+				m_sum -= m_store[i];
+				m_store[i] = value;
+			}
+		}
+
+		//! Count of maximum events under control.
+		unsigned int m_number;
+
+		//! Policy of the window.
+		WINDOW m_window;
 
 		//! Sum of all happened events.
-		unsigned int m_sum;
+		ACCUMULATOR m_sum;
 
 		//! Total counted events.
 		unsigned int m_total;
@@ -91,9 +327,26 @@ class sum_counter_t
 		int m_pointer;
 
 		//! Saves values of all (N) previous events.
-		std::vector <unsigned int> m_store;
+		/*!
+			Is empty if the window does not evict events.
+		*/
+		std::vector< VALUE > m_store;
+
+		//! Last reported sum and total.
+		snapshot_type m_report;
+
+		//! Sum and total for readers.
+		seqlock_t< snapshot_type > m_snapshot;
 };
 
+//! Counter of unsigned int values.
+typedef basic_sum_counter_t< unsigned int, unsigned int > sum_counter_t;
+
+//! Consistent state of sum_counter_t.
+typedef sum_counter_t::snapshot_type sum_counter_snapshot_t;
+
+extern template class basic_sum_counter_t< unsigned int, unsigned int >;
+
 } /* namespace tds */
 
 #endif
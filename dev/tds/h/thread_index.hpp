@@ -0,0 +1,92 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__THREAD_INDEX_HPP__INCLUDED )
+#define _TDS__THREAD_INDEX_HPP__INCLUDED
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace tds {
+
+//! Size of the cache line which is used for padding of the shards.
+const unsigned int cache_line_size = 64;
+
+//! Allocates zeroed blocks of atomic words, each on its own cache lines.
+/*!
+	Size of every block is block_words rounded up to the cache line.
+	Storage is not aligned, so it is one cache line longer.
+
+	\return first word of the first cache line, blocks are
+	stride words one from another.
+*/
+template< typename WORD >
+WORD *
+cache_aligned_blocks(
+	//! Storage of the blocks (is replaced).
+	std::vector< WORD > & store,
+	//! Count of blocks.
+	unsigned int blocks,
+	//! Count of words of one block.
+	unsigned int block_words,
+	//! Distance between the blocks, in words.
+	unsigned int & stride )
+{
+	const unsigned int line_words = cache_line_size / sizeof( WORD );
+
+	stride = ( block_words + line_words - 1 ) / line_words * line_words;
+
+	std::vector< WORD > words( stride * blocks + line_words );
+	store.swap( words );
+
+	for( unsigned int i = 0; i < store.size(); ++i )
+		store[i].store( 0, std::memory_order_relaxed );
+
+	const std::uintptr_t address = reinterpret_cast< std::uintptr_t >( &store[0] );
+	return &store[0] +
+		( cache_line_size - address % cache_line_size ) % cache_line_size / sizeof( WORD );
+}
+
+//! Sequential number of the current thread.
+/*!
+	Threads are numbered 0, 1, 2, ... in order of the first call.
+	The number is used to spread writers over the shards.
+*/
+unsigned int
+current_thread_index();
+
+} /* namespace tds */
+
+#endif
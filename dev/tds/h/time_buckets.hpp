@@ -0,0 +1,186 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__TIME_BUCKETS_HPP__INCLUDED )
+#define _TDS__TIME_BUCKETS_HPP__INCLUDED
+
+#include <vector>
+#include <stdexcept>
+
+namespace tds {
+
+//! Ring of time buckets over the last period.
+/*!
+	Period is split into buckets of equal duration. Values are added
+	into the bucket of the current time, sum of all buckets is kept
+	incrementally. Buckets are rotated lazily: expired buckets are
+	subtracted from the sum only when time is moved by rotate().
+
+	Memory is O(buckets) and does not depend on the rate of the values.
+	Window covers the current bucket and (buckets - 1) previous ones.
+	The current bucket is filled only partly, so the window is from
+	(period - bucket period) to period long, and the oldest values
+	are expired with precision of one bucket.
+
+	Period must be divided by the count of buckets without remainder,
+	otherwise the window would be silently shorter than the period.
+
+	BUCKET must be default constructible to zero and must have
+	operator+= and operator-=.
+
+	Time is given by the caller in milliseconds.
+
+	Not thread-safe.
+*/
+template< typename BUCKET >
+class time_buckets_t
+{
+	public:
+		time_buckets_t(
+			//! Period of the window, ms.
+			unsigned int period,
+			//! Count of buckets in the period.
+			unsigned int buckets ) :
+			m_bucket_period( buckets != 0 ? period / buckets : 0 ),
+			m_current( 0 ),
+			m_sum(),
+			m_store( buckets )
+		{
+			if ( buckets == 0 )
+				throw std::runtime_error(
+					"Null buckets is detected at time_buckets c'tor. Must be more than 0." );
+
+			if ( m_bucket_period == 0 )
+				throw std::runtime_error(
+					"Too short period is detected at time_buckets c'tor. "
+					"Must be not less than 1 ms per bucket." );
+
+			if ( period % buckets != 0 )
+				throw std::runtime_error(
+					"Uneven period is detected at time_buckets c'tor. "
+					"Must be divided by the count of buckets." );
+		}
+
+		//! Moves the window to the given time.
+		/*!
+			Expired buckets are cleared and subtracted from the sum.
+			Time which goes back is treated as the current bucket.
+
+			\return sum of the expired buckets.
+		*/
+		BUCKET
+		rotate( unsigned long long now )
+		{
+			BUCKET expired = BUCKET();
+
+			const unsigned long long index = now / m_bucket_period;
+			if ( index <= m_current )
+				return expired;
+
+			if ( index - m_current >= m_store.size() )
+			{
+				expired = m_sum;
+				m_sum = BUCKET();
+				for( unsigned int i = 0; i < m_store.size(); ++i )
+					m_store[i] = BUCKET();
+			}
+			else
+			{
+				for( unsigned long long i = m_current + 1; i <= index; ++i )
+				{
+					BUCKET & bucket = m_store[ i % m_store.size() ];
+					expired += bucket;
+					m_sum -= bucket;
+					bucket = BUCKET();
+				}
+			}
+
+			m_current = index;
+
+			return expired;
+		}
+
+		//! Adds the value into the bucket of the given time.
+		/*!
+			\return sum of the expired buckets.
+		*/
+		BUCKET
+		add( unsigned long long now, const BUCKET & value )
+		{
+			const BUCKET expired = rotate( now );
+
+			m_store[ m_current % m_store.size() ] += value;
+			m_sum += value;
+
+			return expired;
+		}
+
+		//! Sum of all buckets in the window.
+		const BUCKET &
+		sum() const
+		{
+			return m_sum;
+		}
+
+		//! Duration of one bucket, ms.
+		unsigned int
+		bucket_period() const
+		{
+			return m_bucket_period;
+		}
+
+		//! Count of buckets.
+		unsigned int
+		buckets() const
+		{
+			return m_store.size();
+		}
+
+	private:
+		//! Duration of one bucket, ms.
+		const unsigned int m_bucket_period;
+
+		//! Number of the current bucket since the epoch of time.
+		unsigned long long m_current;
+
+		//! Sum of all buckets.
+		BUCKET m_sum;
+
+		//! Buckets. Bucket with number i is at i % size.
+		std::vector< BUCKET > m_store;
+};
+
+} /* namespace tds */
+
+#endif
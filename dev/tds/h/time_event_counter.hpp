@@ -0,0 +1,136 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__TIME_EVENT_COUNTER_HPP__INCLUDED )
+#define _TDS__TIME_EVENT_COUNTER_HPP__INCLUDED
+
+#include <tds/h/clock.hpp>
+#include <tds/h/time_buckets.hpp>
+
+#include "ace/Mutex.h"
+
+namespace tds {
+
+//! Counts facts that events already happened during the last period of time.
+/*!
+	Stores facts about events of the last T ms, no more.
+	Period is split into buckets, so memory does not depend on
+	the rate of events. Old events are expired with precision
+	of one bucket (T / buckets ms).
+
+	Thread-safe.
+*/
+class time_event_counter_t
+{
+	public:
+		time_event_counter_t(
+			//! Period of time under control, ms.
+			unsigned int period,
+			//! Count of buckets in the period.
+			/*!
+				Period must be divided by it without remainder.
+			*/
+			unsigned int buckets = 10,
+			//! Source of the current time.
+			const clock_interface_t & clock = default_clock() );
+
+		//! Event was happened (true/false).
+		/*!
+			true - positive (happened)
+			false - negative.
+		*/
+		void
+		event( bool what );
+
+		//! Get count of true-events.
+		unsigned int
+		count() const;
+
+		//! Total count of happened events.
+		unsigned int
+		total() const;
+
+		//! Get percentage value of true-events.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		percentage() const;
+
+	private:
+		//! Events of one bucket.
+		struct bucket_t
+		{
+			//! Count of true-events.
+			unsigned int m_count;
+			//! Total count of events.
+			unsigned int m_total;
+
+			bucket_t() :
+				m_count( 0 ), m_total( 0 )
+			{}
+
+			bucket_t &
+			operator += ( const bucket_t & other )
+			{
+				m_count += other.m_count;
+				m_total += other.m_total;
+				return *this;
+			}
+
+			bucket_t &
+			operator -= ( const bucket_t & other )
+			{
+				m_count -= other.m_count;
+				m_total -= other.m_total;
+				return *this;
+			}
+		};
+
+		//! Moves window to the current time and returns the sum.
+		const bucket_t &
+		actual() const;
+
+		//! Source of the current time.
+		const clock_interface_t & m_clock;
+
+		//! Buckets of the period.
+		mutable time_buckets_t< bucket_t > m_buckets;
+
+		mutable ACE_Mutex m_buckets_locker;
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,133 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__VARIANCE_COUNTER_HPP__INCLUDED )
+#define _TDS__VARIANCE_COUNTER_HPP__INCLUDED
+
+#include <vector>
+
+namespace tds {
+
+//! Counts dispersion of special number events (jitter of latency, size, ... ).
+/*!
+	Stores values of last N events, no more, the same window
+	as sum_counter_t has.
+
+	Mean and sum of squared deviations are updated by Welford's
+	method for the sliding window: the new value replaces the evicted
+	one without the sum of squares of raw values, so there is no
+	cancellation of big numbers. All results are O(1).
+
+	Variance is the population variance of the window.
+
+	Not thread-safe.
+*/
+class variance_counter_t
+{
+	public:
+		variance_counter_t(
+			//! Count of maximum events under control (buffer size).
+			unsigned int number );
+
+		//! Event was happened.
+		/*!
+			value - number which describes the event.
+		*/
+		void
+		event( unsigned int value );
+
+		//! Get sum of happened events.
+		unsigned long long
+		sum() const;
+
+		//! Total counted events.
+		unsigned int
+		total() const;
+
+		//! Get arithmetic mean.
+		/*!
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		mean() const;
+
+		//! Get variance.
+		/*!
+			((value1 - mean)^2 + .. + (valueN - mean)^2) / N
+
+			If there were 0 events, result of this function will be 0.
+		*/
+		float
+		variance() const;
+
+		//! Get standard deviation.
+		float
+		stddev() const;
+
+		//! Get coefficient of variation (stddev / mean).
+		/*!
+			If mean is 0, result of this function will be 0.
+		*/
+		float
+		coefficient_of_variation() const;
+
+	private:
+
+		//! Moves pointer to the next event.
+		void
+		next_pointer();
+
+		//! Sum of all happened events.
+		unsigned long long m_sum;
+
+		//! Total counted events.
+		unsigned int m_total;
+
+		//! Mean of the window.
+		double m_mean;
+
+		//! Sum of squared deviations from the mean.
+		double m_squares;
+
+		//! Pointer to the moving through buffer.
+		//! Point out to the element which will be changed next time.
+		unsigned int m_pointer;
+
+		//! Saves values of all (N) previous events.
+		std::vector< unsigned int > m_store;
+};
+
+} /* namespace tds */
+
+#endif
@@ -0,0 +1,143 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined( _TDS__WINDOW_POLICY_HPP__INCLUDED )
+#define _TDS__WINDOW_POLICY_HPP__INCLUDED
+
+#include <stdexcept>
+
+namespace tds {
+
+//! How the window of last N events is moved (for basic_sum_counter_t).
+/*!
+	Policy tells whether old events are evicted one by one,
+	whether the window is started from scratch and when
+	the result of the window is reported.
+*/
+namespace window_policy {
+
+//! Window of last N events, moves by every event.
+class sliding_t
+{
+	public:
+		//! Old events are evicted one by one (buffer is needed).
+		static const bool evicts = true;
+
+		//! Must the window be started from scratch before the event?
+		bool
+		restart( unsigned int /* total */, unsigned int /* number */ ) const
+		{
+			return false;
+		}
+
+		//! Must the result be reported after n events?
+		bool
+		report( unsigned int /* n */ )
+		{
+			return true;
+		}
+};
+
+//! Window of N events, started from scratch when it is full.
+/*!
+	Events are never evicted one by one, so there is no buffer and
+	the start of the next window is O(1).
+*/
+class tumbling_t
+{
+	public:
+		static const bool evicts = false;
+
+		bool
+		restart( unsigned int total, unsigned int number ) const
+		{
+			return total == number;
+		}
+
+		bool
+		report( unsigned int /* n */ )
+		{
+			return true;
+		}
+};
+
+//! Window of last N events, which is reported every stride events.
+/*!
+	Between the reports the result of the previous hop is given.
+*/
+class hopping_t
+{
+	public:
+		static const bool evicts = true;
+
+		explicit hopping_t(
+			//! Count of events between the reports.
+			unsigned int stride ) :
+			m_stride( stride ), m_events( 0 )
+		{
+			if ( stride == 0 )
+				throw std::runtime_error(
+					"Null stride is detected at hopping_t c'tor. Must be more than 0." );
+		}
+
+		bool
+		restart( unsigned int /* total */, unsigned int /* number */ ) const
+		{
+			return false;
+		}
+
+		bool
+		report( unsigned int n )
+		{
+			m_events += n;
+			if ( m_events < m_stride )
+				return false;
+
+			m_events %= m_stride;
+			return true;
+		}
+
+	private:
+		//! Count of events between the reports.
+		unsigned int m_stride;
+
+		//! Count of events since the last report.
+		unsigned int m_events;
+};
+
+};
+
+} /* namespace tds */
+
+#endif
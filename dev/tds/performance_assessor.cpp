@@ -50,27 +50,46 @@ operator < (const executed_task_t & left, const executed_task_t & right)
 	return (left.m_time_in < right.m_time_in);
 }
 
+//
+// performance_assessor_snapshot_t
+//
+
+performance_assessor_snapshot_t &
+performance_assessor_snapshot_t::merge( 
+	const performance_assessor_snapshot_t & other )
+{
+	m_tasks += other.m_tasks;
+	m_sum_size += other.m_sum_size;
+	m_assess_performance_in_tasks += other.m_assess_performance_in_tasks;
+	m_assess_performance_in_size += other.m_assess_performance_in_size;
+
+	return *this;
+}
+
 //
 // performance_assessor_t
 //
 
 performance_assessor_t::performance_assessor_t( 
 	unsigned int period_analysis,
-	unsigned int power ) :
+	unsigned int power,
+	const clock_interface_t & clock ) :
 	m_sum_size( 0 ),
 	m_period_analysis( period_analysis ),
+	m_clock( clock ),
 	m_power( power ),
 	m_power_pool_counter( 0 ),
 	m_power_outgoing_counter( 0 )
 {
 	assess();
+	publish();
 }
 
 void
 performance_assessor_t::add( 
 	unsigned int size )
 {
-	m_executed_tasks.push_back( executed_task_t( size ) );
+	m_executed_tasks.push_back( executed_task_t( size, m_clock.now() ) );
 	m_sum_size += size;
 
 	++m_power_pool_counter;
@@ -80,6 +99,8 @@ performance_assessor_t::add(
 		m_power_outgoing_counter = 0;
 		assess();
 	}
+
+	publish();
 }
 
 void
@@ -89,25 +110,18 @@ performance_assessor_t::cleanup()
 		return;
 
 	const ACE_Time_Value board_time ( 
-		ACE_OS::gettimeofday() - ACE_Time_Value( 0, 1000 * m_period_analysis ) );
+		m_clock.now() - ACE_Time_Value( 0, 1000 * m_period_analysis ) );
 
 	const auto board = 
-		std::lower_bound( 
-			m_executed_tasks.begin(), 
-			m_executed_tasks.end(), 
-			executed_task_t( board_time ) );
+		m_executed_tasks.lower_bound( executed_task_t( board_time ) );
 	
-	for( auto it = m_executed_tasks.begin(); 
-		it != board; ++it )
+	for( executed_tasks_t::size_type i = 0; i != board; ++i )
 	{
-		m_sum_size -= it->m_size;
+		m_sum_size -= m_executed_tasks[i].m_size;
 	}
 
-	for( auto it = m_executed_tasks.cbegin(); it != board; ++it )
-	{
-		++m_power_outgoing_counter;
-	}
-	m_executed_tasks.erase( m_executed_tasks.begin(), board );
+	m_power_outgoing_counter += board;
+	m_executed_tasks.pop_front( board );
 
 	if ( m_executed_tasks.empty() )
 	{
@@ -119,6 +133,8 @@ performance_assessor_t::cleanup()
 		m_power_outgoing_counter = 0;
 		assess();
 	}
+
+	publish();
 }
 
 float
@@ -149,6 +165,150 @@ performance_assessor_t::active() const
 	return true;
 }
 
+performance_assessor_snapshot_t
+performance_assessor_t::snapshot() const
+{
+	return m_snapshot.load();
+}
+
+void
+performance_assessor_t::publish()
+{
+	performance_assessor_snapshot_t snapshot;
+	snapshot.m_tasks = m_executed_tasks.size();
+	snapshot.m_sum_size = m_sum_size;
+	snapshot.m_assess_performance_in_tasks = m_assess_performance_in_tasks;
+	snapshot.m_assess_performance_in_size = m_assess_performance_in_size;
+
+	m_snapshot.store( snapshot );
+}
+
+//
+// performance_assessor_bucketed_t
+//
+
+performance_assessor_bucketed_t::performance_assessor_bucketed_t( 
+	unsigned int period_analysis,
+	unsigned int power,
+	unsigned int buckets,
+	const clock_interface_t & clock ) :
+	m_period_analysis( period_analysis ),
+	m_clock( clock ),
+	m_buckets( period_analysis, buckets ),
+	m_power( power ),
+	m_power_pool_counter( 0 ),
+	m_power_outgoing_counter( 0 ),
+	m_expired()
+{
+	assess();
+	publish();
+}
+
+void
+performance_assessor_bucketed_t::add( 
+	unsigned int size )
+{
+	bucket_t bucket;
+	bucket.m_tasks = 1;
+	bucket.m_sum_size = size;
+
+	//     cleanup(),   performance_assessor_t.
+	m_expired += m_buckets.add( m_clock.now_msec(), bucket );
+
+	++m_power_pool_counter;
+	if ( m_power_pool_counter == m_power )
+	{
+		m_power_pool_counter = 0;
+		m_power_outgoing_counter = 0;
+		assess();
+	}
+
+	publish();
+}
+
+void
+performance_assessor_bucketed_t::cleanup()
+{
+	if( kept().m_tasks == 0 )
+		return;
+
+	m_expired += m_buckets.rotate( m_clock.now_msec() );
+	m_power_outgoing_counter += m_expired.m_tasks;
+	m_expired = bucket_t();
+
+	if ( m_buckets.sum().m_tasks == 0 )
+	{
+		assess();
+	}
+
+	if ( m_power_outgoing_counter >= m_power )
+	{
+		m_power_outgoing_counter = 0;
+		assess();
+	}
+
+	publish();
+}
+
+float
+performance_assessor_bucketed_t::get_assess_performance_in_size() const 
+{
+	return m_assess_performance_in_size;
+}
+
+float
+performance_assessor_bucketed_t::get_assess_performance_in_tasks() const 
+{
+	return m_assess_performance_in_tasks;
+}
+
+performance_assessor_bucketed_t::bucket_t
+performance_assessor_bucketed_t::kept() const
+{
+	bucket_t result = m_buckets.sum();
+	result += m_expired;
+
+	return result;
+}
+
+void
+performance_assessor_bucketed_t::assess()
+{
+	const bucket_t sum = kept();
+
+	m_assess_performance_in_size = 
+		static_cast<float>( sum.m_sum_size ) / m_period_analysis * 1000 / m_power;
+
+	m_assess_performance_in_tasks = 
+		static_cast<float>( sum.m_tasks ) / m_period_analysis * 1000 / m_power;
+}
+
+bool
+performance_assessor_bucketed_t::active() const
+{
+	return true;
+}
+
+performance_assessor_snapshot_t
+performance_assessor_bucketed_t::snapshot() const
+{
+	return m_snapshot.load();
+}
+
+void
+performance_assessor_bucketed_t::publish()
+{
+	const bucket_t sum = kept();
+
+	performance_assessor_snapshot_t snapshot;
+	snapshot.m_tasks = sum.m_tasks;
+	snapshot.m_sum_size = sum.m_sum_size;
+	snapshot.m_assess_performance_in_tasks = m_assess_performance_in_tasks;
+	snapshot.m_assess_performance_in_size = m_assess_performance_in_size;
+
+	m_snapshot.store( snapshot );
+}
+
 //
 // performance_assessor_dummy_t
 //
@@ -181,12 +341,22 @@ performance_assessor_dummy_t::active() const
 	return false;
 }
 
+performance_assessor_snapshot_t
+performance_assessor_dummy_t::snapshot() const
+{
+	performance_assessor_snapshot_t snapshot = {};
+
+	return snapshot;
+}
+
 performance_assessor_interface_t *
 performance_assessor_factory( 
 	const performance_assessor::performance_assessor_type_t & 
 		performance_assessor_type,
 	unsigned int period_analysis,
-	unsigned int assess_power )
+	unsigned int assess_power,
+	const clock_interface_t & clock,
+	unsigned int buckets )
 {
 	switch( performance_assessor_type )
 	{
@@ -195,7 +365,14 @@ performance_assessor_factory(
 		case performance_assessor::simple:
 			return new performance_assessor_t( 
 				period_analysis,
-				assess_power );
+				assess_power,
+				clock );
+		case performance_assessor::bucketed:
+			return new performance_assessor_bucketed_t( 
+				period_analysis,
+				assess_power,
+				buckets,
+				clock );
 		default:
 			throw std::runtime_error( 
 				"Incorrect performance_assessor_type: " + 
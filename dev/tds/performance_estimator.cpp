@@ -51,6 +51,29 @@ operator < (const solved_task_t & left, const solved_task_t & right)
 	return (left.m_time_in < right.m_time_in);
 }
 
+//
+// performance_estimator_snapshot_t
+//
+
+performance_estimator_snapshot_t &
+performance_estimator_snapshot_t::merge( 
+	const performance_estimator_snapshot_t & other )
+{
+	m_tasks += other.m_tasks;
+	m_sum_time_in_progress += other.m_sum_time_in_progress;
+	m_sum_size += other.m_sum_size;
+
+	if ( ( m_tasks != 0 ) && ( m_sum_time_in_progress != 0 ) )
+	{
+		m_estimate_performance_in_size = 
+			static_cast<float>( m_sum_size ) / m_sum_time_in_progress * 1000;
+		m_estimate_performance_in_tasks = 
+			static_cast<float>( m_tasks ) / m_sum_time_in_progress * 1000;
+	}
+
+	return *this;
+}
+
 //
 // performance_estimator_t
 //
@@ -58,13 +81,16 @@ operator < (const solved_task_t & left, const solved_task_t & right)
 performance_estimator_t::performance_estimator_t( 
 	unsigned int period_analysis,
 	float start_estimate_performance_in_tasks,
-	float start_estimate_performance_in_size ) :
-	m_period_analysis( period_analysis ),
+	float start_estimate_performance_in_size,
+	const clock_interface_t & clock ) :
 	m_sum_time_in_progress( 0 ), 
 	m_sum_size( 0 ),
+	m_period_analysis( period_analysis ),
+	m_clock( clock ),
 	m_estimate_performance_in_tasks( start_estimate_performance_in_tasks ),
 	m_estimate_performance_in_size( start_estimate_performance_in_size )
 {
+	publish();
 }
 
 void
@@ -72,11 +98,12 @@ performance_estimator_t::add(
 	unsigned int time_in_way, 
 	unsigned int size )
 {
-	m_solved_tasks.push_back( solved_task_t( time_in_way, size ) );
+	m_solved_tasks.push_back( solved_task_t( time_in_way, size, m_clock.now() ) );
 	m_sum_time_in_progress += time_in_way;
 	m_sum_size += size;
 	
 	estimate();
+	publish();
 }
 
 void
@@ -86,21 +113,20 @@ performance_estimator_t::cleanup()
 		return;
 
 	const ACE_Time_Value board_time ( 
-		ACE_OS::gettimeofday() - ACE_Time_Value( 0, 1000 * m_period_analysis ) );
+		m_clock.now() - ACE_Time_Value( 0, 1000 * m_period_analysis ) );
 
-	const solved_tasks_t::iterator board = 
-		std::lower_bound( 
-			m_solved_tasks.begin(), 
-			m_solved_tasks.end(), 
-			solved_task_t( board_time ) );
+	const solved_tasks_t::size_type board = 
+		m_solved_tasks.lower_bound( solved_task_t( board_time ) );
 	
-	for( solved_tasks_t::iterator it = m_solved_tasks.begin(); it != board; ++it )
+	for( solved_tasks_t::size_type i = 0; i != board; ++i )
 	{
-		m_sum_time_in_progress -= it->m_time_in_progress;
-		m_sum_size -= it->m_size;
+		m_sum_time_in_progress -= m_solved_tasks[i].m_time_in_progress;
+		m_sum_size -= m_solved_tasks[i].m_size;
 	}
 
-	m_solved_tasks.erase( m_solved_tasks.begin(), board );
+	m_solved_tasks.pop_front( board );
+
+	publish();
 }
 
 float
@@ -141,6 +167,122 @@ performance_estimator_t::active() const
 	return true;
 }
 
+performance_estimator_snapshot_t
+performance_estimator_t::snapshot() const
+{
+	return m_snapshot.load();
+}
+
+void
+performance_estimator_t::publish()
+{
+	performance_estimator_snapshot_t snapshot;
+	snapshot.m_tasks = m_solved_tasks.size();
+	snapshot.m_sum_time_in_progress = m_sum_time_in_progress;
+	snapshot.m_sum_size = m_sum_size;
+	snapshot.m_estimate_performance_in_tasks = m_estimate_performance_in_tasks;
+	snapshot.m_estimate_performance_in_size = m_estimate_performance_in_size;
+
+	m_snapshot.store( snapshot );
+}
+
+//
+// performance_estimator_bucketed_t
+//
+
+performance_estimator_bucketed_t::performance_estimator_bucketed_t( 
+	unsigned int period_analysis,
+	float start_estimate_performance_in_tasks,
+	float start_estimate_performance_in_size,
+	unsigned int buckets,
+	const clock_interface_t & clock ) :
+	m_clock( clock ),
+	m_buckets( period_analysis, buckets ),
+	m_estimate_performance_in_tasks( start_estimate_performance_in_tasks ),
+	m_estimate_performance_in_size( start_estimate_performance_in_size )
+{
+	publish();
+}
+
+void
+performance_estimator_bucketed_t::add( 
+	unsigned int time_in_progress, 
+	unsigned int size )
+{
+	bucket_t bucket;
+	bucket.m_tasks = 1;
+	bucket.m_sum_time_in_progress = time_in_progress;
+	bucket.m_sum_size = size;
+
+	m_buckets.add( m_clock.now_msec(), bucket );
+
+	estimate();
+	publish();
+}
+
+void
+performance_estimator_bucketed_t::cleanup()
+{
+	m_buckets.rotate( m_clock.now_msec() );
+
+	publish();
+}
+
+float
+performance_estimator_bucketed_t::get_estimate_performance_in_size() const 
+{
+	return m_estimate_performance_in_size;
+}
+
+float
+performance_estimator_bucketed_t::get_estimate_performance_in_tasks() const 
+{
+	return m_estimate_performance_in_tasks;
+}
+
+void
+performance_estimator_bucketed_t::estimate()
+{
+	const bucket_t & sum = m_buckets.sum();
+
+	if ( 
+		( sum.m_tasks != 0 ) &&
+		( sum.m_sum_time_in_progress != 0 ) )
+	{
+		m_estimate_performance_in_size = 
+			static_cast<float>( sum.m_sum_size ) / sum.m_sum_time_in_progress * 1000;
+		m_estimate_performance_in_tasks = 
+			static_cast<float>( sum.m_tasks ) / sum.m_sum_time_in_progress * 1000;
+	}
+}
+
+bool
+performance_estimator_bucketed_t::active() const
+{
+	return true;
+}
+
+performance_estimator_snapshot_t
+performance_estimator_bucketed_t::snapshot() const
+{
+	return m_snapshot.load();
+}
+
+void
+performance_estimator_bucketed_t::publish()
+{
+	const bucket_t & sum = m_buckets.sum();
+
+	performance_estimator_snapshot_t snapshot;
+	snapshot.m_tasks = sum.m_tasks;
+	snapshot.m_sum_time_in_progress = sum.m_sum_time_in_progress;
+	snapshot.m_sum_size = sum.m_sum_size;
+	snapshot.m_estimate_performance_in_tasks = m_estimate_performance_in_tasks;
+	snapshot.m_estimate_performance_in_size = m_estimate_performance_in_size;
+
+	m_snapshot.store( snapshot );
+}
+
 //
 // performance_estimator_dummy_t
 //
@@ -173,13 +315,28 @@ performance_estimator_dummy_t::active() const
 	return false;
 }
 
+performance_estimator_snapshot_t
+performance_estimator_dummy_t::snapshot() const
+{
+	performance_estimator_snapshot_t snapshot;
+	snapshot.m_tasks = 0;
+	snapshot.m_sum_time_in_progress = 0;
+	snapshot.m_sum_size = 0;
+	snapshot.m_estimate_performance_in_tasks = FLT_MAX;
+	snapshot.m_estimate_performance_in_size = FLT_MAX;
+
+	return snapshot;
+}
+
 performance_estimator_interface_t *
 performance_estimator_factory( 
 	const performance_estimator::performance_estimator_type_t & 
 		performance_estimator_type,
 	unsigned int period_analysis,
 	float start_estimate_performance_in_tasks,
-	float start_estimate_performance_in_size )
+	float start_estimate_performance_in_size,
+	const clock_interface_t & clock,
+	unsigned int buckets )
 {
 	switch( performance_estimator_type )
 	{
@@ -189,7 +346,15 @@ performance_estimator_factory(
 			return new performance_estimator_t( 
 				period_analysis,
 				start_estimate_performance_in_tasks,
-				start_estimate_performance_in_size );
+				start_estimate_performance_in_size,
+				clock );
+		case performance_estimator::bucketed:
+			return new performance_estimator_bucketed_t( 
+				period_analysis,
+				start_estimate_performance_in_tasks,
+				start_estimate_performance_in_size,
+				buckets,
+				clock );
 		default:
 			throw std::runtime_error( 
 				"Incorrect performance_estimator_type: " + 
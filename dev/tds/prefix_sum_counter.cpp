@@ -0,0 +1,101 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/prefix_sum_counter.hpp>
+
+#include <stdexcept>
+
+namespace tds {
+
+prefix_sum_counter_t::prefix_sum_counter_t(
+	unsigned int number ) :
+	m_number( number ),
+	m_events( 0 ),
+	m_store( number + 1ULL, 0 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at prefix_sum_counter c'tor. Must be more than 0." );
+}
+
+void
+prefix_sum_counter_t::event( unsigned long long value )
+{
+	const unsigned long long sum = m_store[ m_events % m_store.size() ];
+
+	++m_events;
+	m_store[ m_events % m_store.size() ] = sum + value;
+}
+
+unsigned long long
+prefix_sum_counter_t::sum_last( unsigned int k ) const
+{
+	if ( k > total() )
+		k = total();
+
+	return m_store[ m_events % m_store.size() ] -
+		m_store[ ( m_events - k ) % m_store.size() ];
+}
+
+float
+prefix_sum_counter_t::mean_last( unsigned int k ) const
+{
+	if ( k > total() )
+		k = total();
+
+	if ( k == 0 )
+		return 0;
+
+	return static_cast< float >( sum_last( k ) ) / k;
+}
+
+unsigned long long
+prefix_sum_counter_t::sum() const
+{
+	return sum_last( m_number );
+}
+
+float
+prefix_sum_counter_t::mean() const
+{
+	return mean_last( m_number );
+}
+
+unsigned int
+prefix_sum_counter_t::total() const
+{
+	return m_events < m_number ? m_events : m_number;
+}
+
+} /* namespace tds */
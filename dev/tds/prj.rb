@@ -19,4 +19,17 @@ MxxRu::Cpp::lib_target {
 	cpp_source 'volume_controller.cpp' 
 #	cpp_source 'event_counter.cpp' 
 	cpp_source 'sum_counter.cpp' 
+	cpp_source 'atomic_event_counter.cpp' 
+	cpp_source 'sharded_event_counter.cpp' 
+	cpp_source 'thread_index.cpp' 
+	cpp_source 'quantile_counter.cpp' 
+	cpp_source 'variance_counter.cpp' 
+	cpp_source 'prefix_sum_counter.cpp' 
+	cpp_source 'rollup_counter.cpp' 
+	cpp_source 'atomic_sum_counter.cpp' 
+	cpp_source 'change_detector.cpp' 
+#	cpp_source 'time_event_counter.cpp' 
+#	cpp_source 'time_sum_counter.cpp' 
+#	cpp_source 'circuit_breaker.cpp' 
+#	cpp_source 'clock.cpp' 
 }
@@ -0,0 +1,150 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/quantile_counter.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace tds {
+
+quantile_counter_t::quantile_counter_t(
+	unsigned int number,
+	unsigned int max_value,
+	unsigned int bucket_width ) :
+	m_max_value( max_value ),
+	m_bucket_width( bucket_width ),
+	m_total( 0 ),
+	m_pointer( 0 ),
+	m_store( number, 0 ),
+	m_top( 1 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at quantile_counter c'tor. Must be more than 0." );
+
+	if ( bucket_width == 0 )
+		throw std::runtime_error(
+			"Null bucket width is detected at quantile_counter c'tor. Must be more than 0." );
+
+	const unsigned int buckets = max_value / bucket_width + 1;
+	m_tree.assign( buckets + 1, 0 );
+
+	while( m_top * 2 <= buckets )
+		m_top *= 2;
+}
+
+void
+quantile_counter_t::event( unsigned int value )
+{
+	const unsigned int bucket =
+		( value < m_max_value ? value : m_max_value ) / m_bucket_width;
+
+	if ( m_total == m_store.size() )
+	{
+		if ( m_store[ m_pointer ] == bucket )
+		{
+			next_pointer();
+			return;
+		}
+
+		add( m_store[ m_pointer ], -1 );
+	}
+
+	add( bucket, 1 );
+	m_store[ m_pointer ] = bucket;
+
+	next_pointer();
+}
+
+unsigned int
+quantile_counter_t::quantile( float q ) const
+{
+	if ( m_total == 0 )
+		return 0;
+
+	unsigned int rank = static_cast< unsigned int >( std::ceil( q * m_total ) );
+	if ( rank == 0 )
+		rank = 1;
+	else if ( rank > m_total )
+		rank = m_total;
+
+	const unsigned int last = find( rank ) * m_bucket_width + m_bucket_width - 1;
+
+	return last < m_max_value ? last : m_max_value;
+}
+
+unsigned int
+quantile_counter_t::total() const
+{
+	return m_total;
+}
+
+void
+quantile_counter_t::add( unsigned int bucket, int delta )
+{
+	for( unsigned int i = bucket + 1; i < m_tree.size(); i += i & ( 0 - i ) )
+		m_tree[i] += delta;
+}
+
+unsigned int
+quantile_counter_t::find( unsigned int rank ) const
+{
+	// The last position where prefix count is less than rank.
+	unsigned int position = 0;
+
+	for( unsigned int step = m_top; step != 0; step /= 2 )
+		if ( position + step < m_tree.size() && m_tree[ position + step ] < rank )
+		{
+			position += step;
+			rank -= m_tree[ position ];
+		}
+
+	// Position is the count of buckets before the found one.
+	return position;
+}
+
+void
+quantile_counter_t::next_pointer()
+{
+	if ( m_pointer == 0 )
+		m_pointer = m_store.size() - 1;
+	else
+		--m_pointer;
+
+	if ( m_total < m_store.size() )
+		++m_total;
+}
+
+} /* namespace tds */
@@ -0,0 +1,95 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/rollup_counter.hpp>
+
+#include <stdexcept>
+
+namespace tds {
+
+rollup_counter_t::rollup_counter_t(
+	const std::vector< unsigned int > & levels ) :
+	m_sizes( levels ),
+	m_pending( levels.size(), 0 )
+{
+	if ( levels.empty() )
+		throw std::runtime_error(
+			"Null levels is detected at rollup_counter c'tor. Must be more than 0." );
+
+	m_levels.reserve( levels.size() );
+	for( unsigned int i = 0; i < levels.size(); ++i )
+		m_levels.push_back( prefix_sum_counter_t( levels[i] ) );
+}
+
+void
+rollup_counter_t::event( unsigned long long value )
+{
+	for( unsigned int level = 0; level < m_levels.size(); ++level )
+	{
+		m_levels[ level ].event( value );
+
+		if ( ++m_pending[ level ] != m_sizes[ level ] )
+			break;
+
+		// Level is filled by new buckets, it is one bucket of the next level.
+		m_pending[ level ] = 0;
+		value = m_levels[ level ].sum();
+	}
+}
+
+unsigned long long
+rollup_counter_t::sum( unsigned int level, unsigned int k ) const
+{
+	return m_levels.at( level ).sum_last( k );
+}
+
+float
+rollup_counter_t::mean( unsigned int level, unsigned int k ) const
+{
+	return m_levels.at( level ).mean_last( k );
+}
+
+unsigned int
+rollup_counter_t::total( unsigned int level ) const
+{
+	return m_levels.at( level ).total();
+}
+
+unsigned int
+rollup_counter_t::levels() const
+{
+	return m_levels.size();
+}
+
+} /* namespace tds */
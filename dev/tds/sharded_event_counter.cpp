@@ -0,0 +1,165 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/sharded_event_counter.hpp>
+
+#include <tds/h/thread_index.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+namespace tds {
+
+sharded_event_counter_t::sharded_event_counter_t(
+	unsigned int number,
+	unsigned int shards ) :
+	m_number( number ), m_shards( shards ), m_stride( 0 ), m_base( 0 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at sharded_event_counter c'tor. Must be more than 0." );
+
+	if ( m_shards == 0 )
+		m_shards = std::thread::hardware_concurrency();
+	if ( m_shards == 0 )
+		m_shards = 1;
+	if ( m_shards > number )
+		m_shards = number;
+
+	const unsigned int window_words = ( shard_number( 0 ) + 63 ) / 64;
+
+	m_base = cache_aligned_blocks(
+		m_store, m_shards, header_words + window_words, m_stride );
+}
+
+void
+sharded_event_counter_t::event( bool what )
+{
+	event( what, current_thread_index() );
+}
+
+void
+sharded_event_counter_t::event( bool what, unsigned int shard )
+{
+	shard %= m_shards;
+	word_t * words = shard_words( shard );
+
+	const unsigned long long position =
+		words[ head_word ].fetch_add( 1, std::memory_order_relaxed ) %
+			shard_number( shard );
+
+	word_t & word = words[ header_words + position / 64 ];
+	const unsigned long long mask = 1ULL << ( position % 64 );
+
+	// Change had place or not?
+	if ( what )
+	{
+		if ( !( word.fetch_or( mask, std::memory_order_relaxed ) & mask ) )
+			words[ count_word ].fetch_add( 1, std::memory_order_relaxed );
+	}
+	else
+	{
+		if ( word.fetch_and( ~mask, std::memory_order_relaxed ) & mask )
+			words[ count_word ].fetch_sub( 1, std::memory_order_relaxed );
+	}
+}
+
+unsigned int
+sharded_event_counter_t::count() const
+{
+	long long result = 0;
+
+	for( unsigned int shard = 0; shard < m_shards; ++shard )
+	{
+		const long long count = static_cast< long long >(
+			shard_words( shard )[ count_word ].load( std::memory_order_relaxed ) );
+
+		if ( count > 0 )
+			result += count;
+	}
+
+	return static_cast< unsigned int >( result );
+}
+
+unsigned int
+sharded_event_counter_t::total() const
+{
+	unsigned int result = 0;
+
+	for( unsigned int shard = 0; shard < m_shards; ++shard )
+	{
+		const unsigned long long head =
+			shard_words( shard )[ head_word ].load( std::memory_order_relaxed );
+		const unsigned int number = shard_number( shard );
+
+		result += head < number ? static_cast< unsigned int >( head ) : number;
+	}
+
+	return result;
+}
+
+float
+sharded_event_counter_t::percentage() const
+{
+	const unsigned int total_events = total();
+	if ( total_events == 0 )
+		return 0;
+
+	const unsigned int count_events = count();
+	if ( count_events >= total_events )
+		return 100;
+
+	return count_events * 100.0 / total_events;
+}
+
+unsigned int
+sharded_event_counter_t::shards() const
+{
+	return m_shards;
+}
+
+sharded_event_counter_t::word_t *
+sharded_event_counter_t::shard_words( unsigned int shard ) const
+{
+	return m_base + shard * m_stride;
+}
+
+unsigned int
+sharded_event_counter_t::shard_number( unsigned int shard ) const
+{
+	// First shards take the remainder of the division.
+	return m_number / m_shards + ( shard < m_number % m_shards ? 1 : 0 );
+}
+
+} /* namespace tds */
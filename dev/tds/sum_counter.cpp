@@ -34,63 +34,8 @@
 
 #include <tds/h/sum_counter.hpp>
 
-#include <stdexcept>
-
 namespace tds {
 
-sum_counter_t::sum_counter_t( 
-	unsigned int number ) : 
-	m_store( number, false ), m_pointer( 0 ), m_sum( 0 ), m_total( 0 )
-{
-	if (number == 0)
-		throw std::runtime_error( "Null number is detected at sum_counter c'tor. Must be more than 0." );
-}
-
-void
-sum_counter_t::event( unsigned int value )
-{
-	// Change had place or not?
-	if ( m_store[m_pointer] != value )
-	{
-		m_sum += value;
-		m_sum -= m_store[m_pointer];
-		m_store[m_pointer] = value;
-	}
-
-	next_pointer();
-}
-
-unsigned int 
-sum_counter_t::sum() const
-{
-	return m_sum;
-}
-
-unsigned int 
-sum_counter_t::total() const
-{
-	return m_total;
-}
-
-float
-sum_counter_t::mean() const
-{
-	if ( m_total == 0 )
-		return 0;
-
-	return static_cast<float>( m_sum ) / m_total;
-}
-
-void
-sum_counter_t::next_pointer() 
-{
-	if ( m_pointer == 0 )
-		m_pointer = m_store.size() - 1;
-	else
-		--m_pointer;
-
-	if ( m_total < m_store.size() ) 
-		++m_total;
-}
+template class basic_sum_counter_t< unsigned int, unsigned int >;
 
 } /* namespace tds */
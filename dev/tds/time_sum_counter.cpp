@@ -0,0 +1,108 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/time_sum_counter.hpp>
+
+#include "ace/Guard_T.h"
+
+namespace tds {
+
+time_sum_counter_t::time_sum_counter_t(
+	unsigned int period,
+	unsigned int buckets,
+	const clock_interface_t & clock ) :
+	m_clock( clock ),
+	m_buckets( period, buckets )
+{
+}
+
+void
+time_sum_counter_t::event( unsigned int value )
+{
+	bucket_t bucket;
+	bucket.m_sum = value;
+	bucket.m_total = 1;
+
+	ACE_Guard<ACE_Mutex> guard( m_buckets_locker );
+
+	m_buckets.add( m_clock.now_msec(), bucket );
+}
+
+unsigned long long
+time_sum_counter_t::sum() const
+{
+	ACE_Guard<ACE_Mutex> guard( m_buckets_locker );
+
+	return actual().m_sum;
+}
+
+unsigned int
+time_sum_counter_t::total() const
+{
+	ACE_Guard<ACE_Mutex> guard( m_buckets_locker );
+
+	return actual().m_total;
+}
+
+float
+time_sum_counter_t::mean() const
+{
+	ACE_Guard<ACE_Mutex> guard( m_buckets_locker );
+
+	const bucket_t & sum = actual();
+	if ( sum.m_total == 0 )
+		return 0;
+
+	return static_cast< float >( sum.m_sum ) / sum.m_total;
+}
+
+float
+time_sum_counter_t::rate_per_second() const
+{
+	ACE_Guard<ACE_Mutex> guard( m_buckets_locker );
+
+	const unsigned int period = m_buckets.bucket_period() * m_buckets.buckets();
+
+	return static_cast< float >( actual().m_sum ) * 1000 / period;
+}
+
+const time_sum_counter_t::bucket_t &
+time_sum_counter_t::actual() const
+{
+	m_buckets.rotate( m_clock.now_msec() );
+
+	return m_buckets.sum();
+}
+
+} /* namespace tds */
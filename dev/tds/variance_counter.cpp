@@ -0,0 +1,142 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/variance_counter.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace tds {
+
+variance_counter_t::variance_counter_t(
+	unsigned int number ) :
+	m_sum( 0 ), m_total( 0 ), m_mean( 0 ), m_squares( 0 ),
+	m_pointer( 0 ), m_store( number, 0 )
+{
+	if ( number == 0 )
+		throw std::runtime_error(
+			"Null number is detected at variance_counter c'tor. Must be more than 0." );
+}
+
+void
+variance_counter_t::event( unsigned int value )
+{
+	const double x = value;
+
+	if ( m_total < m_store.size() )
+	{
+		// Window grows.
+		const double delta = x - m_mean;
+		m_mean += delta / ( m_total + 1 );
+		m_squares += delta * ( x - m_mean );
+	}
+	else
+	{
+		// Value replaces the evicted one.
+		const double y = m_store[ m_pointer ];
+		const double mean = m_mean;
+		m_mean += ( x - y ) / m_total;
+		m_squares += ( x - y ) * ( x - m_mean + y - mean );
+		m_sum -= m_store[ m_pointer ];
+	}
+
+	// Rounding errors must not make it negative.
+	if ( m_squares < 0 )
+		m_squares = 0;
+
+	m_sum += value;
+	m_store[ m_pointer ] = value;
+
+	next_pointer();
+}
+
+unsigned long long
+variance_counter_t::sum() const
+{
+	return m_sum;
+}
+
+unsigned int
+variance_counter_t::total() const
+{
+	return m_total;
+}
+
+float
+variance_counter_t::mean() const
+{
+	if ( m_total == 0 )
+		return 0;
+
+	return static_cast< float >( m_sum ) / m_total;
+}
+
+float
+variance_counter_t::variance() const
+{
+	if ( m_total == 0 )
+		return 0;
+
+	return m_squares / m_total;
+}
+
+float
+variance_counter_t::stddev() const
+{
+	return std::sqrt( variance() );
+}
+
+float
+variance_counter_t::coefficient_of_variation() const
+{
+	const float average = mean();
+	if ( average == 0 )
+		return 0;
+
+	return stddev() / average;
+}
+
+void
+variance_counter_t::next_pointer()
+{
+	if ( m_pointer == 0 )
+		m_pointer = m_store.size() - 1;
+	else
+		--m_pointer;
+
+	if ( m_total < m_store.size() )
+		++m_total;
+}
+
+} /* namespace tds */
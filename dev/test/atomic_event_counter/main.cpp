@@ -0,0 +1,248 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/atomic_event_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+#include <deque>
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+//! Serial reference: the same window on a plain deque.
+class reference_counter_t
+{
+	public:
+		reference_counter_t( unsigned int number ) :
+			m_number( number )
+		{}
+
+		void
+		event( bool what )
+		{
+			m_store.push_back( what );
+			if ( m_store.size() > m_number )
+				m_store.pop_front();
+		}
+
+		unsigned int
+		count() const
+		{
+			unsigned int result = 0;
+			for( std::deque< bool >::const_iterator it = m_store.begin();
+				it != m_store.end(); ++it )
+			{
+				if ( *it )
+					++result;
+			}
+			return result;
+		}
+
+		unsigned int
+		total() const
+		{
+			return m_store.size();
+		}
+
+	private:
+		unsigned int m_number;
+		std::deque< bool > m_store;
+};
+
+TEST( Start, Simple )
+{
+	tds::atomic_event_counter_t event_counter( 10 );
+
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::atomic_event_counter_t event_counter( 0 ), std::exception );
+}
+
+TEST( Overload, AllTrue )
+{
+	const unsigned int number = 10;
+	tds::atomic_event_counter_t event_counter( number );
+	ASSERT_EQ( event_counter.total(), 0 );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 100 );
+	}
+	ASSERT_EQ( event_counter.total(), number );
+}
+
+TEST( Overload, AllFalse )
+{
+	const unsigned int number = 10;
+	tds::atomic_event_counter_t event_counter( number );
+	ASSERT_EQ( event_counter.total(), 0 );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		event_counter.event( false );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+	}
+	ASSERT_EQ( event_counter.total(), number );
+}
+
+TEST( Run, Fidelity )
+{
+	const unsigned int number = 10;
+	tds::atomic_event_counter_t event_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+		event_counter.event( false );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 100.0*(i+1)/10.0 );
+	}
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 10;
+	tds::atomic_event_counter_t event_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_EQ( event_counter.total(), i+1  );
+		EXPECT_EQ( event_counter.count(), i+1  );
+	}
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( false );
+		EXPECT_EQ( event_counter.total(), number  );
+		EXPECT_EQ( event_counter.count(), number-i-1  );
+	}
+}
+
+TEST( Run, SerialReference )
+{
+	// Window crosses the border of the 64-bit words.
+	const unsigned int number = 130;
+	tds::atomic_event_counter_t event_counter( number );
+	reference_counter_t reference( number );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 10*number; ++i )
+	{
+		const bool what = ( std::rand() % 3 ) == 0;
+		event_counter.event( what );
+		reference.event( what );
+
+		ASSERT_EQ( event_counter.total(), reference.total() );
+		ASSERT_EQ( event_counter.count(), reference.count() );
+	}
+}
+
+TEST( Stress, AllTrue )
+{
+	const unsigned int number = 100;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::atomic_event_counter_t event_counter( number );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&event_counter]() {
+			for( unsigned int i = 0; i < events; ++i )
+				event_counter.event( true );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( event_counter.total(), number );
+	EXPECT_EQ( event_counter.count(), number );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 100 );
+}
+
+TEST( Stress, SerialReference )
+{
+	const unsigned int number = 200;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::atomic_event_counter_t event_counter( number );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&event_counter, t]() {
+			for( unsigned int i = 0; i < events; ++i )
+				event_counter.event( ( i + t ) % 3 == 0 );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( event_counter.total(), number );
+	EXPECT_LE( event_counter.count(), number );
+
+	// All the window is rewritten serially, so any drift of the
+	// concurrent phase would be seen against the reference.
+	reference_counter_t reference( number );
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		const bool what = ( i % 7 ) < 3;
+		event_counter.event( what );
+		reference.event( what );
+	}
+
+	EXPECT_EQ( event_counter.total(), reference.total() );
+	EXPECT_EQ( event_counter.count(), reference.count() );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/atomic_sum_counter.hpp>
+#include <tds/h/sum_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::atomic_sum_counter_t sum_counter( 10, 4 );
+
+	EXPECT_EQ( sum_counter.total(), 0 );
+	EXPECT_EQ( sum_counter.sum(), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 0 );
+	EXPECT_EQ( sum_counter.partials(), 4 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::atomic_sum_counter_t sum_counter( 0 ), std::exception );
+
+	tds::atomic_sum_counter_t by_hardware( 10 );
+	EXPECT_GE( by_hardware.partials(), 1 );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 10;
+	tds::atomic_sum_counter_t sum_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		sum_counter.event( 1 );
+		EXPECT_EQ( sum_counter.total(), i+1  );
+		EXPECT_EQ( sum_counter.sum(), i+1  );
+	}
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		sum_counter.event( 0 );
+		EXPECT_EQ( sum_counter.total(), number  );
+		EXPECT_EQ( sum_counter.sum(), number-i-1  );
+	}
+}
+
+TEST( Run, Reference )
+{
+	const unsigned int number = 37;
+	tds::atomic_sum_counter_t sum_counter( number );
+	tds::sum_counter_t reference( number );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 10 * number; ++i )
+	{
+		const unsigned int value = std::rand() % 1000;
+		sum_counter.event( value );
+		reference.event( value );
+
+		ASSERT_EQ( sum_counter.total(), reference.total() );
+		ASSERT_EQ( sum_counter.sum(), reference.sum() );
+		ASSERT_FLOAT_EQ( sum_counter.mean(), reference.mean() );
+	}
+}
+
+TEST( Run, Wide )
+{
+	tds::atomic_sum_counter_t sum_counter( 10 );
+
+	for( unsigned int i = 0; i < 20; ++i )
+		sum_counter.event( UINT_MAX );
+
+	EXPECT_EQ( sum_counter.sum(), 10ULL * UINT_MAX );
+}
+
+TEST( Stress, AllTen )
+{
+	const unsigned int number = 100;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::atomic_sum_counter_t sum_counter( number, 4 );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&sum_counter]() {
+			for( unsigned int i = 0; i < events; ++i )
+				sum_counter.event( 10 );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( sum_counter.total(), number );
+	EXPECT_EQ( sum_counter.sum(), 10 * number );
+}
+
+TEST( Stress, Consistency )
+{
+	const unsigned int number = 128;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::atomic_sum_counter_t sum_counter( number );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&sum_counter, t]() {
+			for( unsigned int i = 0; i < events; ++i )
+				sum_counter.event( ( i + t ) % 7 );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	// Whole window is rewritten by one thread.
+	for( unsigned int i = 0; i < number; ++i )
+		sum_counter.event( i % 4 );
+
+	EXPECT_EQ( sum_counter.total(), number );
+	EXPECT_EQ( sum_counter.sum(), ( 0 + 1 + 2 + 3 ) * number / 4 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,145 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/change_detector.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+#include <vector>
+
+namespace tds {
+
+//! Value around the level with noise of +-10.
+double
+noisy( double level )
+{
+	return level + std::rand() % 21 - 10;
+}
+
+TEST( Start, Simple )
+{
+	tds::change_detector_t change_detector( 5, 100 );
+
+	EXPECT_FALSE( change_detector.changed() );
+	EXPECT_EQ( change_detector.direction(), tds::change_detector::none );
+	EXPECT_EQ( change_detector.total(), 0 );
+	EXPECT_DOUBLE_EQ( change_detector.mean(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::change_detector_t change_detector( 5, 0 ), std::exception );
+}
+
+TEST( Start, NegativeTolerance )
+{
+	EXPECT_THROW( tds::change_detector_t change_detector( -1, 200 ), std::exception );
+}
+
+TEST( Run, Stationary )
+{
+	tds::change_detector_t change_detector( 5, 200 );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 100000; ++i )
+		change_detector.event( noisy( 100 ) );
+
+	EXPECT_FALSE( change_detector.changed() );
+	EXPECT_NEAR( change_detector.mean(), 100, 1 );
+}
+
+TEST( Run, Increase )
+{
+	tds::change_detector_t change_detector( 5, 200 );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 1000; ++i )
+		change_detector.event( noisy( 100 ) );
+	ASSERT_FALSE( change_detector.changed() );
+
+	unsigned int events = 0;
+	while( !change_detector.changed() && events < 1000 )
+	{
+		change_detector.event( noisy( 150 ) );
+		++events;
+	}
+
+	EXPECT_TRUE( change_detector.changed() );
+	EXPECT_EQ( change_detector.direction(), tds::change_detector::increase );
+	EXPECT_LT( events, 20 );
+
+	// Statistics are started from the new level.
+	for( unsigned int i = 0; i < 10; ++i )
+		change_detector.event( 150 );
+	EXPECT_DOUBLE_EQ( change_detector.mean(), 150 );
+
+	change_detector.reset();
+	EXPECT_FALSE( change_detector.changed() );
+	EXPECT_EQ( change_detector.total(), 0 );
+}
+
+TEST( Run, Callback )
+{
+	std::vector< tds::change_detector::direction_t > changes;
+	tds::change_detector_t change_detector( 5, 200,
+		[&changes]( tds::change_detector::direction_t direction ) {
+			changes.push_back( direction );
+		} );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 1000; ++i )
+		change_detector.event( noisy( 100 ) );
+	for( unsigned int i = 0; i < 1000; ++i )
+		change_detector.event( noisy( 50 ) );
+	for( unsigned int i = 0; i < 1000; ++i )
+		change_detector.event( noisy( 100 ) );
+
+	ASSERT_EQ( changes.size(), 2 );
+	EXPECT_EQ( changes[0], tds::change_detector::decrease );
+	EXPECT_EQ( changes[1], tds::change_detector::increase );
+	EXPECT_EQ( change_detector.direction(), tds::change_detector::increase );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,8 @@
+require 'mxx_ru/binary_unittest'
+
+path = 'test/change_detector'
+
+MxxRu::setup_target(
+	MxxRu::BinaryUnittestTarget.new(
+		"#{path}/prj.ut.rb",
+		"#{path}/prj.rb" ) ) 
@@ -0,0 +1,225 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/circuit_breaker.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <tds/h/clock.hpp>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::circuit_breaker_t breaker( 10, 50, 5, 0, 100 );
+
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+	EXPECT_TRUE( breaker.allow() );
+	EXPECT_FLOAT_EQ( breaker.failure_percentage(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::circuit_breaker_t breaker( 0, 50, 5, 0, 100 ), std::exception );
+	EXPECT_THROW( tds::circuit_breaker_t breaker( 10, 50, 5, 0, 100, 0 ), std::exception );
+}
+
+TEST( Closed, MinimumVolume )
+{
+	tds::circuit_breaker_t breaker( 10, 50, 5, 0, 100 );
+
+	// 100% of failures, but not enough events.
+	for( unsigned int i = 0; i < 4; ++i )
+		breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+	EXPECT_TRUE( breaker.allow() );
+
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+	EXPECT_FALSE( breaker.allow() );
+}
+
+TEST( Closed, Threshold )
+{
+	tds::circuit_breaker_t breaker( 10, 50, 5, 0, 100 );
+
+	for( unsigned int i = 0; i < 10; ++i )
+	{
+		breaker.success();
+		breaker.success();
+		breaker.failure();
+	}
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+
+	// Failure pushes out the oldest failure.
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+	EXPECT_FLOAT_EQ( breaker.failure_percentage(), 40 );
+
+	// 5 failures of 10.
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+	EXPECT_FLOAT_EQ( breaker.failure_percentage(), 50 );
+}
+
+TEST( Closed, Consecutive )
+{
+	tds::circuit_breaker_t breaker( 100, 90, 50, 3, 100 );
+
+	breaker.failure();
+	breaker.failure();
+	breaker.success();
+	breaker.failure();
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+}
+
+TEST( HalfOpen, Close )
+{
+	tds::virtual_clock_t clock;
+	tds::circuit_breaker_t breaker( 10, 50, 1, 0, 100, 2, clock );
+
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+
+	// Results of the requests which were sent before are ignored.
+	breaker.success();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+
+	clock.advance( 150 );
+
+	const circuit_breaker::permit_t first = breaker.allow();
+	EXPECT_EQ( first, circuit_breaker::probe );
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+	const circuit_breaker::permit_t second = breaker.allow();
+	EXPECT_EQ( second, circuit_breaker::probe );
+	EXPECT_FALSE( breaker.allow() );
+
+	breaker.success( first );
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+	breaker.success( second );
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+
+	// Window is empty after closing.
+	EXPECT_FLOAT_EQ( breaker.failure_percentage(), 0 );
+	EXPECT_TRUE( breaker.allow() );
+}
+
+TEST( HalfOpen, Reopen )
+{
+	tds::virtual_clock_t clock;
+	tds::circuit_breaker_t breaker( 10, 50, 1, 0, 100, 1, clock );
+
+	breaker.failure();
+	EXPECT_FALSE( breaker.allow() );
+
+	clock.advance( 150 );
+
+	const circuit_breaker::permit_t permit = breaker.allow();
+	EXPECT_EQ( permit, circuit_breaker::probe );
+	breaker.failure( permit );
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+	EXPECT_FALSE( breaker.allow() );
+}
+
+TEST( HalfOpen, LostProbe )
+{
+	tds::virtual_clock_t clock;
+	tds::circuit_breaker_t breaker( 10, 50, 1, 0, 100, 1, clock );
+
+	breaker.failure();
+	clock.advance( 150 );
+
+	// Result of the probe is never reported.
+	EXPECT_EQ( breaker.allow(), circuit_breaker::probe );
+	for( unsigned int i = 0; i < 1000; ++i )
+		EXPECT_FALSE( breaker.allow() );
+
+	clock.advance( 50 );
+	EXPECT_FALSE( breaker.allow() );
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+
+	// Probes are lost after the open period.
+	clock.advance( 50 );
+	const circuit_breaker::permit_t permit = breaker.allow();
+	EXPECT_EQ( permit, circuit_breaker::probe );
+	EXPECT_FALSE( breaker.allow() );
+
+	breaker.success( permit );
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+}
+
+TEST( HalfOpen, LateResults )
+{
+	tds::virtual_clock_t clock;
+	tds::circuit_breaker_t breaker( 10, 50, 1, 0, 100, 1, clock );
+
+	const circuit_breaker::permit_t early_success = breaker.allow();
+	const circuit_breaker::permit_t early_failure = breaker.allow();
+	EXPECT_EQ( early_success, circuit_breaker::request );
+
+	breaker.failure();
+	EXPECT_EQ( breaker.state(), circuit_breaker::open );
+
+	clock.advance( 150 );
+
+	const circuit_breaker::permit_t permit = breaker.allow();
+	EXPECT_EQ( permit, circuit_breaker::probe );
+
+	// Requests of the closed state are not probes.
+	breaker.success( early_success );
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+	breaker.failure( early_failure );
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+	breaker.success();
+	EXPECT_EQ( breaker.state(), circuit_breaker::half_open );
+
+	breaker.success( permit );
+	EXPECT_EQ( breaker.state(), circuit_breaker::closed );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
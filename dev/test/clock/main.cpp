@@ -0,0 +1,156 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/clock.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <ace/OS_NS_time.h>
+
+namespace tds {
+
+//! Time of the clock does not go back.
+void
+check_monotonic( const clock_interface_t & clock )
+{
+	ACE_Time_Value previous = clock.now();
+	for( unsigned int i = 0; i < 10000; ++i )
+	{
+		const ACE_Time_Value current = clock.now();
+		EXPECT_TRUE( previous <= current );
+		previous = current;
+	}
+}
+
+TEST( Monotonic, System )
+{
+	check_monotonic( system_clock_t() );
+}
+
+TEST( Monotonic, Monotonic )
+{
+	check_monotonic( monotonic_clock_t() );
+}
+
+TEST( Monotonic, Coarse )
+{
+	check_monotonic( coarse_clock_t() );
+}
+
+TEST( Monotonic, Ticker )
+{
+	check_monotonic( ticker_clock_t() );
+}
+
+TEST( Monotonic, Virtual )
+{
+	check_monotonic( virtual_clock_t() );
+}
+
+TEST( Virtual, Advance )
+{
+	virtual_clock_t clock;
+	EXPECT_EQ( clock.now_msec(), 0 );
+
+	clock.advance( 150 );
+	EXPECT_EQ( clock.now_msec(), 150 );
+	EXPECT_TRUE( clock.now() == ACE_Time_Value( 0, 150*1000 ) );
+
+	clock.advance( 0 );
+	EXPECT_EQ( clock.now_msec(), 150 );
+
+	// Years of the time in CPU time only.
+	for( unsigned int i = 0; i < 1000000; ++i )
+		clock.advance( 1000000 );
+	EXPECT_EQ( clock.now_msec(), 150 + 1000000ULL * 1000000 );
+}
+
+TEST( Virtual, Set )
+{
+	virtual_clock_t clock( ACE_Time_Value( 100 ) );
+	EXPECT_EQ( clock.now_msec(), 100*1000 );
+
+	clock.set( ACE_Time_Value( 5, 500*1000 ) );
+	EXPECT_EQ( clock.now_msec(), 5500 );
+
+	clock.advance( 500 );
+	EXPECT_TRUE( clock.now() == ACE_Time_Value( 6 ) );
+}
+
+TEST( Run, Msec )
+{
+	const monotonic_clock_t clock;
+
+	const unsigned long long before = clock.now_msec();
+	ACE_OS::sleep( ACE_Time_Value( 0, 50000 ) );
+	const unsigned long long after = clock.now_msec();
+
+	EXPECT_GE( after - before, 50 );
+	EXPECT_LT( after - before, 1000 );
+}
+
+TEST( Run, Ticker )
+{
+	const ticker_clock_t ticker( 1 );
+	const monotonic_clock_t clock;
+
+	const unsigned long long before = ticker.now_msec();
+	ACE_OS::sleep( ACE_Time_Value( 0, 50000 ) );
+	const unsigned long long after = ticker.now_msec();
+
+	EXPECT_GE( after - before, 40 );
+	EXPECT_LT( after - before, 1000 );
+
+	// Ticker and monotonic clock count from the same moment.
+	EXPECT_LT( clock.now_msec() - ticker.now_msec(), 100 );
+}
+
+TEST( Run, Default )
+{
+	const unsigned long long system = system_clock_t().now_msec();
+	const unsigned long long by_default = default_clock().now_msec();
+
+	EXPECT_GE( by_default, system );
+	EXPECT_LT( by_default - system, 1000 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,181 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/compact_event_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::compact_event_counter_t< 10 > event_counter;
+
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+}
+
+TEST( Start, Size )
+{
+	EXPECT_EQ( sizeof( tds::compact_event_counter_t< 1 > ), 8 );
+	EXPECT_EQ( sizeof( tds::compact_event_counter_t< 58 > ), 8 );
+}
+
+TEST( Overload, AllTrue )
+{
+	const unsigned int number = 10;
+	tds::compact_event_counter_t< number > event_counter;
+	ASSERT_EQ( event_counter.total(), 0 );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 100 );
+	}
+	ASSERT_EQ( event_counter.total(), number );
+}
+
+TEST( Overload, AllFalse )
+{
+	const unsigned int number = 58;
+	tds::compact_event_counter_t< number > event_counter;
+	ASSERT_EQ( event_counter.total(), 0 );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		event_counter.event( false );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+	}
+	ASSERT_EQ( event_counter.total(), number );
+}
+
+TEST( Run, Fidelity )
+{
+	const unsigned int number = 10;
+	tds::compact_event_counter_t< number > event_counter;
+
+	for( unsigned int i = 0; i < number; ++i )
+		event_counter.event( false );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 100.0*(i+1)/10.0 );
+	}
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 58;
+	tds::compact_event_counter_t< number > event_counter;
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_EQ( event_counter.total(), i+1  );
+		EXPECT_EQ( event_counter.count(), i+1  );
+	}
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( false );
+		EXPECT_EQ( event_counter.total(), number  );
+		EXPECT_EQ( event_counter.count(), number-i-1  );
+	}
+}
+
+TEST( Run, Snapshot )
+{
+	tds::compact_event_counter_t< 4 > event_counter;
+
+	tds::event_counter_snapshot_t snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, 0 );
+	EXPECT_EQ( snapshot.m_total, 0 );
+	EXPECT_FLOAT_EQ( snapshot.percentage(), 0 );
+
+	for( unsigned int i = 0; i < 6; ++i )
+		event_counter.event( i % 2 == 0 );
+
+	snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, 2 );
+	EXPECT_EQ( snapshot.m_total, 4 );
+	EXPECT_FLOAT_EQ( snapshot.percentage(), event_counter.percentage() );
+}
+
+TEST( Run, One )
+{
+	tds::compact_event_counter_t< 1 > event_counter;
+
+	event_counter.event( true );
+	EXPECT_EQ( event_counter.count(), 1 );
+	event_counter.event( false );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_EQ( event_counter.total(), 1 );
+}
+
+TEST( Stress, AllTrue )
+{
+	const unsigned int threads = 4;
+	const unsigned int events = 100000;
+	tds::compact_event_counter_t< 32 > event_counter;
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&event_counter]() {
+			for( unsigned int i = 0; i < events; ++i )
+				event_counter.event( true );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( event_counter.total(), 32 );
+	EXPECT_EQ( event_counter.count(), 32 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -32,16 +32,22 @@
 	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <tds_1/h/event_counter.hpp>
+#include <tds/h/event_counter.hpp>
+#include <tds/h/merged_view.hpp>
 
 #include <limits.h>
 #include "gtest/1.6.0/include/gtest/gtest.h"
 
 #include <stdexcept>
 
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 TEST( Start, Simple ) 
 {
-	tds_1::event_counter_t event_counter( 10 );
+	tds::event_counter_t event_counter( 10 );
 
 	EXPECT_EQ( event_counter.total(), 0 );
 	EXPECT_EQ( event_counter.count(), 0 );
@@ -50,13 +56,13 @@ TEST( Start, Simple )
 
 TEST( Start, Null )
 {	
-	EXPECT_THROW( tds_1::event_counter_t event_counter( 0 ), std::exception );
+	EXPECT_THROW( tds::event_counter_t event_counter( 0 ), std::exception );
 }
 
 TEST( Overload, AllTrue )
 {
 	const unsigned int number = 10;
-	tds_1::event_counter_t event_counter( number );
+	tds::event_counter_t event_counter( number );
 	ASSERT_EQ( event_counter.total(), 0 );
 
 	for( unsigned int i = 0; i < 2*number; ++i )
@@ -71,7 +77,7 @@ TEST( Overload, AllTrue )
 TEST( Overload, AllFalse )
 {
 	const unsigned int number = 10;
-	tds_1::event_counter_t event_counter( number );
+	tds::event_counter_t event_counter( number );
 	ASSERT_EQ( event_counter.total(), 0 );
 
 	for( unsigned int i = 0; i < 2*number; ++i )
@@ -86,7 +92,7 @@ TEST( Overload, AllFalse )
 TEST( Run, Fidelity )
 {
 	const unsigned int number = 10;
-	tds_1::event_counter_t event_counter( number );
+	tds::event_counter_t event_counter( number );
 
 	for( unsigned int i = 0; i < number; ++i )
 		event_counter.event( false );
@@ -101,7 +107,7 @@ TEST( Run, Fidelity )
 TEST( Run, Values )
 {
 	const unsigned int number = 10;
-	tds_1::event_counter_t event_counter( number );
+	tds::event_counter_t event_counter( number );
 
 	for( unsigned int i = 0; i < number; ++i )
 	{
@@ -118,6 +124,150 @@ TEST( Run, Values )
 	}
 }
 
+TEST( Run, Reset )
+{
+	const unsigned int number = 10;
+	tds::event_counter_t event_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+		event_counter.event( true );
+
+	event_counter.reset();
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+
+	event_counter.event( false );
+	event_counter.event( true );
+	EXPECT_EQ( event_counter.total(), 2 );
+	EXPECT_EQ( event_counter.count(), 1 );
+}
+
+TEST( Batch, EventN )
+{
+	// Window crosses the border of the 64-bit words.
+	const unsigned int number = 100;
+	tds::event_counter_t batch( number );
+	tds::event_counter_t single( number );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 200; ++i )
+	{
+		const bool what = ( std::rand() % 3 ) == 0;
+		const unsigned int n = std::rand() % ( i % 10 == 0 ? 250 : 70 );
+
+		batch.event_n( what, n );
+		for( unsigned int j = 0; j < n; ++j )
+			single.event( what );
+
+		ASSERT_EQ( batch.total(), single.total() );
+		ASSERT_EQ( batch.count(), single.count() );
+	}
+}
+
+TEST( Batch, Events )
+{
+	const unsigned int number = 70;
+	tds::event_counter_t batch( number );
+	tds::event_counter_t single( number );
+
+	std::vector< bool > values;
+	for( unsigned int i = 0; i < 64; ++i )
+		values.push_back( i % 3 == 0 );
+
+	for( unsigned int i = 0; i < 5; ++i )
+	{
+		batch.events( values.begin(), values.end() );
+		for( unsigned int j = 0; j < values.size(); ++j )
+			single.event( values[j] );
+
+		ASSERT_EQ( batch.total(), single.total() );
+		ASSERT_EQ( batch.count(), single.count() );
+
+		// Ordering is kept: the last events are false.
+		batch.event_n( false, 3 );
+		single.event( false );
+		single.event( false );
+		single.event( false );
+		ASSERT_EQ( batch.count(), single.count() );
+	}
+}
+
+TEST( Snapshot, Values )
+{
+	const unsigned int number = 10;
+	tds::event_counter_t event_counter( number );
+
+	tds::event_counter_snapshot_t snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, 0 );
+	EXPECT_EQ( snapshot.m_total, 0 );
+	EXPECT_FLOAT_EQ( snapshot.percentage(), 0 );
+
+	for( unsigned int i = 0; i < 4; ++i )
+		event_counter.event( i % 2 == 0 );
+
+	snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, 2 );
+	EXPECT_EQ( snapshot.m_total, 4 );
+	EXPECT_FLOAT_EQ( snapshot.percentage(), 50 );
+
+	event_counter.event_n( true, 20 );
+	snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, number );
+	EXPECT_EQ( snapshot.m_total, number );
+
+	event_counter.reset();
+	snapshot = event_counter.snapshot();
+	EXPECT_EQ( snapshot.m_count, 0 );
+	EXPECT_EQ( snapshot.m_total, 0 );
+}
+
+TEST( Snapshot, Stress )
+{
+	const unsigned int number = 1000;
+	const unsigned int events = 200000;
+	tds::event_counter_t event_counter( number );
+	std::atomic< bool > done( false );
+	std::atomic< unsigned int > torn( 0 );
+
+	// Only true-events, so count and total must be equal.
+	std::thread reader( [&]() {
+		while( !done.load() )
+		{
+			const tds::event_counter_snapshot_t snapshot =
+				event_counter.snapshot();
+			if ( snapshot.m_count != snapshot.m_total )
+				++torn;
+		}
+	} );
+
+	for( unsigned int i = 0; i < events; ++i )
+		event_counter.event( true );
+	done = true;
+	reader.join();
+
+	EXPECT_EQ( torn.load(), 0 );
+	EXPECT_EQ( event_counter.snapshot().m_total, number );
+}
+
+TEST( Snapshot, Merge )
+{
+	tds::event_counter_t first( 10 );
+	tds::event_counter_t second( 20 );
+
+	first.event_n( true, 4 );
+	second.event_n( true, 2 );
+	second.event_n( false, 14 );
+
+	tds::event_counter_t * counters[] = { &first, &second };
+	const tds::event_counter_snapshot_t view =
+		tds::merged_view( counters, counters + 2 );
+
+	EXPECT_EQ( view.m_count, 6 );
+	EXPECT_EQ( view.m_total, 20 );
+	EXPECT_FLOAT_EQ( view.percentage(), 30 );
+}
+
 int 
 main( int argc, char ** argv ) 
 {
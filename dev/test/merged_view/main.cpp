@@ -0,0 +1,134 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/merged_view.hpp>
+#include <tds/h/sum_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+TEST( Start, Empty )
+{
+	std::vector< tds::sum_counter_t > counters;
+
+	const tds::sum_counter_snapshot_t view =
+		tds::merged_view( counters.begin(), counters.end() );
+	EXPECT_EQ( view.m_sum, 0 );
+	EXPECT_EQ( view.m_total, 0 );
+	EXPECT_FLOAT_EQ( view.mean(), 0 );
+}
+
+TEST( Run, Merge )
+{
+	tds::sum_counter_snapshot_t left = { 10, 2 };
+	const tds::sum_counter_snapshot_t right = { 20, 3 };
+
+	left.merge( right );
+	EXPECT_EQ( left.m_sum, 30 );
+	EXPECT_EQ( left.m_total, 5 );
+	EXPECT_FLOAT_EQ( left.mean(), 6 );
+}
+
+TEST( Run, Objects )
+{
+	std::vector< tds::sum_counter_t > counters;
+
+	for( unsigned int i = 0; i < 3; ++i )
+	{
+		counters.push_back( tds::sum_counter_t( 10 ) );
+		for( unsigned int j = 0; j <= i; ++j )
+			counters.back().event( 10 * ( i + 1 ) );
+	}
+
+	const tds::sum_counter_snapshot_t view =
+		tds::merged_view( counters.begin(), counters.end() );
+	EXPECT_EQ( view.m_sum, 10 + 2 * 20 + 3 * 30 );
+	EXPECT_EQ( view.m_total, 1 + 2 + 3 );
+}
+
+TEST( Run, Threads )
+{
+	const unsigned int threads = 4;
+	const unsigned int events = 100000;
+	const unsigned int number = 100;
+
+	std::vector< std::unique_ptr< tds::sum_counter_t > > owners;
+	std::vector< tds::sum_counter_t * > counters;
+	for( unsigned int t = 0; t < threads; ++t )
+	{
+		owners.push_back( std::unique_ptr< tds::sum_counter_t >(
+			new tds::sum_counter_t( number ) ) );
+		counters.push_back( owners.back().get() );
+	}
+
+	// Every thread writes into its own counter.
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&counters, t]() {
+			for( unsigned int i = 0; i < events; ++i )
+				counters[t]->event( t + 1 );
+		} ) );
+
+	// Aggregator merges the shards while they are written.
+	for( unsigned int i = 0; i < 100; ++i )
+	{
+		const tds::sum_counter_snapshot_t view =
+			tds::merged_view( counters.begin(), counters.end() );
+		ASSERT_LE( view.m_total, threads * number );
+		ASSERT_LE( view.m_sum, ( 1 + 2 + 3 + 4 ) * number );
+	}
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	const tds::sum_counter_snapshot_t view =
+		tds::merged_view( counters.begin(), counters.end() );
+	EXPECT_EQ( view.m_total, threads * number );
+	EXPECT_EQ( view.m_sum, ( 1 + 2 + 3 + 4 ) * number );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/outcome_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+#include <deque>
+
+namespace tds {
+
+enum outcome_t
+{
+	success,
+	timeout,
+	rejected,
+	error
+};
+
+typedef tds::outcome_counter_t< outcome_t, 4 > request_counter_t;
+
+enum wide_outcome_t
+{
+	wide_first,
+	wide_last = 11
+};
+
+TEST( Start, Simple )
+{
+	request_counter_t outcome_counter( 10 );
+
+	EXPECT_EQ( outcome_counter.total(), 0 );
+	EXPECT_EQ( outcome_counter.count( success ), 0 );
+	EXPECT_FLOAT_EQ( outcome_counter.share( success ), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( request_counter_t outcome_counter( 0 ), std::exception );
+}
+
+TEST( Start, OutOfRange )
+{
+	request_counter_t outcome_counter( 10 );
+	const outcome_t wrong = static_cast< outcome_t >( 4 );
+
+	EXPECT_THROW( outcome_counter.event( wrong ), std::exception );
+	EXPECT_THROW( outcome_counter.count( wrong ), std::exception );
+	EXPECT_THROW( outcome_counter.share( wrong ), std::exception );
+
+	// Counter is not changed.
+	EXPECT_EQ( outcome_counter.total(), 0 );
+	EXPECT_EQ( outcome_counter.count( success ), 0 );
+}
+
+TEST( Overload, AllSuccess )
+{
+	const unsigned int number = 10;
+	request_counter_t outcome_counter( number );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		outcome_counter.event( success );
+		EXPECT_FLOAT_EQ( outcome_counter.share( success ), 100 );
+		EXPECT_FLOAT_EQ( outcome_counter.share( error ), 0 );
+	}
+	ASSERT_EQ( outcome_counter.total(), number );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 10;
+	request_counter_t outcome_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		outcome_counter.event( timeout );
+		EXPECT_EQ( outcome_counter.total(), i+1 );
+		EXPECT_EQ( outcome_counter.count( timeout ), i+1 );
+	}
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		outcome_counter.event( rejected );
+		EXPECT_EQ( outcome_counter.total(), number );
+		EXPECT_EQ( outcome_counter.count( timeout ), number-i-1 );
+		EXPECT_EQ( outcome_counter.count( rejected ), i+1 );
+	}
+}
+
+template< typename OUTCOME, unsigned int OUTCOMES >
+void
+check_reference( unsigned int number )
+{
+	tds::outcome_counter_t< OUTCOME, OUTCOMES > outcome_counter( number );
+	std::deque< unsigned int > reference;
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 10*number; ++i )
+	{
+		const unsigned int what = std::rand() % OUTCOMES;
+		outcome_counter.event( static_cast< OUTCOME >( what ) );
+		reference.push_back( what );
+		if ( reference.size() > number )
+			reference.pop_front();
+
+		ASSERT_EQ( outcome_counter.total(), reference.size() );
+		for( unsigned int o = 0; o < OUTCOMES; ++o )
+		{
+			unsigned int count = 0;
+			for( unsigned int j = 0; j < reference.size(); ++j )
+				if ( reference[j] == o )
+					++count;
+
+			ASSERT_EQ( outcome_counter.count( static_cast< OUTCOME >( o ) ), count );
+			ASSERT_FLOAT_EQ(
+				outcome_counter.share( static_cast< OUTCOME >( o ) ),
+				count * 100.0 / reference.size() );
+		}
+	}
+}
+
+TEST( Run, Reference )
+{
+	// Window crosses the border of the words.
+	check_reference< outcome_t, 4 >( 45 );
+}
+
+TEST( Run, WideReference )
+{
+	// 4 bits per event.
+	check_reference< wide_outcome_t, 12 >( 37 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
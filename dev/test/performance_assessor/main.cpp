@@ -32,20 +32,19 @@
 	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <tds_1/h/performance_assessor.hpp>
+#include <tds/h/performance_assessor.hpp>
 
 #include <limits.h>
 #include "gtest/1.6.0/include/gtest/gtest.h"
 
 #include <stdexcept>
+#include <memory>
 
-#include <cstdlib>
-#include <ace/OS_NS_time.h>
-#include <ace/Time_Value.h>
+#include <tds/h/clock.hpp>
 
-using tds_1::performance_assessor_t;
+using tds::performance_assessor_t;
 
-namespace tds_1 {
+namespace tds {
 	
 TEST( PerformanceAssessor, Empty ) 
 {
@@ -75,15 +74,55 @@ TEST( PerformanceAssessorTest, Add )
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1+1)*1000.0/period );
 }
 
-TEST( PerformanceAssessor, TimeCleanup ) 
+TEST( PerformanceAssessor, Snapshot ) 
 {
 	const unsigned int period = 200;
 	performance_assessor_t performance_assessor( period );
+
+	tds::performance_assessor_snapshot_t snapshot = 
+		performance_assessor.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 0 );
+	EXPECT_EQ( snapshot.m_sum_size, 0 );
+
+	performance_assessor.add( 5 );
+	performance_assessor.add( 2 );
+
+	snapshot = performance_assessor.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 2 );
+	EXPECT_EQ( snapshot.m_sum_size, 7 );
+	EXPECT_FLOAT_EQ( snapshot.m_assess_performance_in_size, (5+2)*1000.0/period );
+	EXPECT_FLOAT_EQ( snapshot.m_assess_performance_in_tasks, 2*1000.0/period );
+}
+
+TEST( PerformanceAssessor, Merge ) 
+{
+	const unsigned int period = 200;
+	performance_assessor_t first( period );
+	performance_assessor_t second( period );
+
+	first.add( 5 );
+	second.add( 5 );
+	second.add( 2 );
+
+	tds::performance_assessor_snapshot_t view = first.snapshot();
+	view.merge( second.snapshot() );
+
+	EXPECT_EQ( view.m_tasks, 3 );
+	EXPECT_EQ( view.m_sum_size, 12 );
+	EXPECT_FLOAT_EQ( view.m_assess_performance_in_size, (5+5+2)*1000.0/period );
+	EXPECT_FLOAT_EQ( view.m_assess_performance_in_tasks, 3*1000.0/period );
+}
+
+TEST( PerformanceAssessor, TimeCleanup ) 
+{
+	const unsigned int period = 200;
+	tds::virtual_clock_t clock;
+	performance_assessor_t performance_assessor( period, 1, clock );
 	performance_assessor.add( 5 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value(0, 100*1000 ) );
+	clock.advance( 100 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
@@ -93,13 +132,13 @@ TEST( PerformanceAssessor, TimeCleanup )
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), (5+5)*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1)*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 	performance_assessor.cleanup();
 
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
@@ -108,11 +147,12 @@ TEST( PerformanceAssessor, TimeCleanup )
 
 TEST( PerformanceAssessor, TimeLowerBound )
 {
-	performance_assessor_t performance_assessor( 290 );
+	tds::virtual_clock_t clock;
+	performance_assessor_t performance_assessor( 290, 1, clock );
 	for( unsigned int i = 0; i < 10; ++i )
 	{
 		performance_assessor.add( 5 );
-		ACE_OS::sleep( ACE_Time_Value( 0, 50*1000 ) );
+		clock.advance( 50 );
 	}	
 	
 	performance_assessor.cleanup();
@@ -122,7 +162,8 @@ TEST( PerformanceAssessor, TimeLowerBound )
 TEST( PerformanceAssessor, Power ) 
 {
 	const unsigned int period = 200;
-	performance_assessor_t performance_assessor( period, 3 );
+	tds::virtual_clock_t clock;
+	performance_assessor_t performance_assessor( period, 3, clock );
 	performance_assessor.add( 5 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
@@ -133,7 +174,7 @@ TEST( PerformanceAssessor, Power )
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value(0, 100*1000 ) );
+	clock.advance( 100 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
@@ -149,13 +190,13 @@ TEST( PerformanceAssessor, Power )
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), (5+5)*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1)*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 	performance_assessor.cleanup();
 
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
@@ -166,12 +207,13 @@ TEST( PerformanceAssessor, Power )
 TEST( PerformanceAssessor, PowerAtomic ) 
 {
 	const unsigned int period = 200;
-	performance_assessor_t performance_assessor( period, 3 );
+	tds::virtual_clock_t clock;
+	performance_assessor_t performance_assessor( period, 3, clock );
 	performance_assessor.add( 5 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 100*1000 ) );
+	clock.advance( 100 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
@@ -184,20 +226,243 @@ TEST( PerformanceAssessor, PowerAtomic )
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 100 );
+	performance_assessor.cleanup();
+
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+}
+
+TEST( PerformanceAssessorBucketed, Add ) 
+{
+	const unsigned int period = 200;
+	tds::performance_assessor_bucketed_t performance_assessor( period );
+	EXPECT_NEAR( performance_assessor.get_assess_performance_in_size(), 0, 1e-5 );
+	EXPECT_NEAR( performance_assessor.get_assess_performance_in_tasks(), 0, 1e-5 );
+
+	performance_assessor.add( 5 );
+	performance_assessor.add( 5 );
+	performance_assessor.add( 2 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), (5+5+2)*1000.0/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1+1)*1000.0/period );
+
+	const tds::performance_assessor_snapshot_t snapshot = 
+		performance_assessor.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 3 );
+	EXPECT_EQ( snapshot.m_sum_size, 12 );
+}
+
+TEST( PerformanceAssessorBucketed, Null ) 
+{
+	EXPECT_THROW( 
+		tds::performance_assessor_bucketed_t performance_assessor( 200, 1, 0 ), 
+		std::exception );
+	EXPECT_THROW( 
+		tds::performance_assessor_bucketed_t performance_assessor( 1005, 1, 10 ), 
+		std::exception );
+}
+
+TEST( PerformanceAssessorBucketed, TimeCleanup ) 
+{
+	const unsigned int period = 200;
+	tds::virtual_clock_t clock;
+	tds::performance_assessor_bucketed_t performance_assessor( period, 1, 4, clock );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 100 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), (5+5)*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1)*1000/period );
+
+	clock.advance( 150 );
 
 	performance_assessor.cleanup();
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 100*1000 ) );
+	clock.advance( 150 );
 	performance_assessor.cleanup();
 
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
 	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
 }
 
-} /* namespace tds_1 */
+TEST( PerformanceAssessorBucketed, Power ) 
+{
+	const unsigned int period = 200;
+	tds::virtual_clock_t clock;
+	tds::performance_assessor_bucketed_t performance_assessor( period, 3, 4, clock );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 100 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), (5+5)*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), (1+1)*1000/period );
+
+	clock.advance( 150 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 150 );
+	performance_assessor.cleanup();
+
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+}
+
+TEST( PerformanceAssessorBucketed, PowerAtomic ) 
+{
+	const unsigned int period = 200;
+	tds::virtual_clock_t clock;
+	tds::performance_assessor_bucketed_t performance_assessor( period, 3, 4, clock );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+
+	clock.advance( 100 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+	performance_assessor.add( 5 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 150 );
+
+	performance_assessor.cleanup();
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 5*1000/period );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 1*1000/period );
+
+	clock.advance( 100 );
+	performance_assessor.cleanup();
+
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_size(), 0 );
+	EXPECT_FLOAT_EQ( performance_assessor.get_assess_performance_in_tasks(), 0 );
+}
+
+TEST( PerformanceAssessorBucketed, SameAsSimple )
+{
+	//     10    50  : 
+	//    5   50     , 
+	//    200 .    250 / 200 .
+	const unsigned int power = 3;
+	tds::virtual_clock_t clock( ACE_Time_Value( 0, 10*1000 ) );
+	performance_assessor_t simple( 200, power, clock );
+	tds::performance_assessor_bucketed_t bucketed( 250, power, 5, clock );
+
+	unsigned int random = 1;
+	for( unsigned int step = 0; step < 3000; ++step )
+	{
+		random = random * 1103515245 + 12345;
+		const unsigned int choice = ( random >> 16 ) % 16;
+
+		if ( choice < 6 )
+		{
+			simple.add( choice + 1 );
+			bucketed.add( choice + 1 );
+		}
+		else if ( choice < 10 )
+		{
+			simple.cleanup();
+			bucketed.cleanup();
+		}
+		else
+			clock.advance( 50 * ( choice - 9 ) );
+
+		ASSERT_FLOAT_EQ( bucketed.get_assess_performance_in_size() * 250, 
+			simple.get_assess_performance_in_size() * 200 ) << step;
+		ASSERT_FLOAT_EQ( bucketed.get_assess_performance_in_tasks() * 250, 
+			simple.get_assess_performance_in_tasks() * 200 ) << step;
+		ASSERT_EQ( bucketed.snapshot().m_tasks, simple.snapshot().m_tasks ) << step;
+	}
+}
+
+TEST( PerformanceAssessorBucketed, Simulation )
+{
+	//    10    .
+	tds::virtual_clock_t clock;
+	tds::performance_assessor_bucketed_t performance_assessor( 10000, 1, 10, clock );
+	for( unsigned int i = 0; i < 24*3600*100; ++i )
+	{
+		performance_assessor.add( 2 );
+		clock.advance( 10 );
+
+		if( i % 1000 == 0 )
+			performance_assessor.cleanup();
+	}
+
+	performance_assessor.cleanup();
+	EXPECT_GE( performance_assessor.snapshot().m_tasks, 900 );
+	EXPECT_LE( performance_assessor.snapshot().m_tasks, 1000 );
+}
+
+TEST( PerformanceAssessor, Factory ) 
+{
+	std::unique_ptr< tds::performance_assessor_interface_t > dummy( 
+		tds::performance_assessor_factory( 
+			tds::performance_assessor::dummy, 200, 1 ) );
+	EXPECT_FALSE( dummy->active() );
+
+	std::unique_ptr< tds::performance_assessor_interface_t > simple( 
+		tds::performance_assessor_factory( 
+			tds::performance_assessor::simple, 200, 2 ) );
+	std::unique_ptr< tds::performance_assessor_interface_t > bucketed( 
+		tds::performance_assessor_factory( 
+			tds::performance_assessor::bucketed, 200, 2 ) );
+	EXPECT_TRUE( simple->active() );
+	EXPECT_TRUE( bucketed->active() );
+
+	for( unsigned int i = 0; i < 4; ++i )
+	{
+		simple->add( 5 );
+		bucketed->add( 5 );
+		EXPECT_FLOAT_EQ( bucketed->get_assess_performance_in_size(), 
+			simple->get_assess_performance_in_size() );
+		EXPECT_FLOAT_EQ( bucketed->get_assess_performance_in_tasks(), 
+			simple->get_assess_performance_in_tasks() );
+	}
+}
+
+} /* namespace tds */
 
 int main( int argc, char ** argv ) 
 {
@@ -32,20 +32,19 @@
 	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <tds_1/h/performance_estimator.hpp>
+#include <tds/h/performance_estimator.hpp>
 
 #include <limits.h>
 #include "gtest/1.6.0/include/gtest/gtest.h"
 
 #include <stdexcept>
+#include <memory>
 
-#include <cstdlib>
-#include <ace/OS_NS_time.h>
-#include <ace/Time_Value.h>
+#include <tds/h/clock.hpp>
 
-using tds_1::performance_estimator_t;
+using tds::performance_estimator_t;
 
-namespace tds_1 {
+namespace tds {
 	
 TEST( PerformanceEstimator, Empty ) 
 {
@@ -81,14 +80,57 @@ TEST( PerformanceEstimatorTest, Add )
 	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), (1+1+1)*1000.0/(200+200+400) );
 }
 
-TEST( PerformanceEstimator, TimeCleanup ) 
+TEST( PerformanceEstimator, Snapshot ) 
 {
 	performance_estimator_t performance_estimator( 200, 10, 10 );
+
+	tds::performance_estimator_snapshot_t snapshot = 
+		performance_estimator.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 0 );
+	EXPECT_FLOAT_EQ( snapshot.m_estimate_performance_in_size, 10 );
+	EXPECT_FLOAT_EQ( snapshot.m_estimate_performance_in_tasks, 10 );
+
+	performance_estimator.add( 200, 5 );
+	performance_estimator.add( 400, 2 );
+
+	snapshot = performance_estimator.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 2 );
+	EXPECT_EQ( snapshot.m_sum_time_in_progress, 600 );
+	EXPECT_EQ( snapshot.m_sum_size, 7 );
+	EXPECT_FLOAT_EQ( snapshot.m_estimate_performance_in_size, 
+		performance_estimator.get_estimate_performance_in_size() );
+	EXPECT_FLOAT_EQ( snapshot.m_estimate_performance_in_tasks, 
+		performance_estimator.get_estimate_performance_in_tasks() );
+}
+
+TEST( PerformanceEstimator, Merge ) 
+{
+	performance_estimator_t first( 200, 10, 10 );
+	performance_estimator_t second( 200, 10, 10 );
+
+	first.add( 200, 5 );
+	second.add( 200, 5 );
+	second.add( 400, 2 );
+
+	tds::performance_estimator_snapshot_t view = first.snapshot();
+	view.merge( second.snapshot() );
+
+	EXPECT_EQ( view.m_tasks, 3 );
+	EXPECT_EQ( view.m_sum_time_in_progress, 800 );
+	EXPECT_EQ( view.m_sum_size, 12 );
+	EXPECT_FLOAT_EQ( view.m_estimate_performance_in_size, (5+5+2)*1000.0/(200+200+400) );
+	EXPECT_FLOAT_EQ( view.m_estimate_performance_in_tasks, (1+1+1)*1000.0/(200+200+400) );
+}
+
+TEST( PerformanceEstimator, TimeCleanup ) 
+{
+	tds::virtual_clock_t clock;
+	performance_estimator_t performance_estimator( 200, 10, 10, clock );
 	performance_estimator.add( 200, 5 );
 	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 25 );
 	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 5 );
 
-	ACE_OS::sleep( ACE_Time_Value(0, 100*1000 ) );
+	clock.advance( 100 );
 
 	performance_estimator.cleanup();
 	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 25 );
@@ -96,7 +138,7 @@ TEST( PerformanceEstimator, TimeCleanup )
 
 	performance_estimator.add( 100, 3 );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 
 	performance_estimator.cleanup();
 	const float estimate_size = performance_estimator.get_estimate_performance_in_size();
@@ -104,7 +146,7 @@ TEST( PerformanceEstimator, TimeCleanup )
 	EXPECT_NE( static_cast<unsigned int>(estimate_size), 25 );
 	EXPECT_NE( static_cast<unsigned int>(estimate_tasks), 5 );
 
-	ACE_OS::sleep( ACE_Time_Value( 0, 150*1000 ) );
+	clock.advance( 150 );
 
 	performance_estimator.cleanup();
 	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), estimate_size );
@@ -117,18 +159,153 @@ TEST( PerformanceEstimator, TimeCleanup )
 
 TEST( PerformanceEstimator, TimeLowerBound )
 {
-	tds_1::performance_estimator_t performance_estimator( 290, 10, 10 );
+	tds::virtual_clock_t clock;
+	tds::performance_estimator_t performance_estimator( 290, 10, 10, clock );
 	for( unsigned int i = 0; i < 10; ++i )
 	{
 		performance_estimator.add( 200, 5 );
-		ACE_OS::sleep( ACE_Time_Value( 0, 50*1000 ) );
+		clock.advance( 50 );
 	}	
 	
 	performance_estimator.cleanup();
 	EXPECT_EQ( performance_estimator.m_solved_tasks.size(), 5 );
 }
 
-} /* namespace tds_1 */
+TEST( PerformanceEstimator, Simulation )
+{
+	// One task per 10 ms during 24 hours of the virtual time.
+	tds::virtual_clock_t clock;
+	tds::performance_estimator_t performance_estimator( 10000, 10, 10, clock );
+	for( unsigned int i = 0; i < 24*3600*100; ++i )
+	{
+		performance_estimator.add( 20, 1 + i % 3 );
+		clock.advance( 10 );
+
+		if( i % 1000 == 0 )
+			performance_estimator.cleanup();
+	}
+
+	performance_estimator.cleanup();
+	EXPECT_EQ( performance_estimator.snapshot().m_tasks, 1000 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 1000.0/20 );
+	EXPECT_NEAR( performance_estimator.get_estimate_performance_in_size(), 2*1000.0/20, 0.1 );
+}
+
+TEST( PerformanceEstimatorBucketed, Add ) 
+{
+	tds::performance_estimator_bucketed_t performance_estimator( 200, 10, 10 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 10 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 10 );
+
+	performance_estimator.add( 200, 5 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 25 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 5 );
+
+	performance_estimator.add( 200, 5 );
+	performance_estimator.add( 400, 2 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), (5+5+2)*1000.0/(200+200+400) );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), (1+1+1)*1000.0/(200+200+400) );
+
+	const tds::performance_estimator_snapshot_t snapshot = 
+		performance_estimator.snapshot();
+	EXPECT_EQ( snapshot.m_tasks, 3 );
+	EXPECT_EQ( snapshot.m_sum_time_in_progress, 800 );
+	EXPECT_EQ( snapshot.m_sum_size, 12 );
+}
+
+TEST( PerformanceEstimatorBucketed, Null ) 
+{
+	EXPECT_THROW( 
+		tds::performance_estimator_bucketed_t performance_estimator( 200, 10, 10, 0 ), 
+		std::exception );
+	EXPECT_THROW( 
+		tds::performance_estimator_bucketed_t performance_estimator( 5, 10, 10, 10 ), 
+		std::exception );
+	EXPECT_THROW( 
+		tds::performance_estimator_bucketed_t performance_estimator( 1005, 10, 10, 10 ), 
+		std::exception );
+}
+
+TEST( PerformanceEstimatorBucketed, TimeCleanup ) 
+{
+	//   50 .
+	tds::virtual_clock_t clock;
+	tds::performance_estimator_bucketed_t performance_estimator( 200, 10, 10, 4, clock );
+	performance_estimator.add( 200, 5 );
+
+	clock.advance( 100 );
+
+	performance_estimator.cleanup();
+	EXPECT_EQ( performance_estimator.snapshot().m_tasks, 1 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 25 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 5 );
+
+	performance_estimator.add( 100, 3 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), (5+3)*1000.0/(200+100) );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 2*1000.0/(200+100) );
+
+	clock.advance( 150 );
+
+	performance_estimator.cleanup();
+	EXPECT_EQ( performance_estimator.snapshot().m_tasks, 1 );
+	EXPECT_EQ( performance_estimator.snapshot().m_sum_size, 3 );
+
+	clock.advance( 150 );
+
+	//     .
+	performance_estimator.cleanup();
+	EXPECT_EQ( performance_estimator.snapshot().m_tasks, 0 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), (5+3)*1000.0/(200+100) );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 2*1000.0/(200+100) );
+
+	performance_estimator.add( 200, 5 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_size(), 25 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 5 );
+}
+
+TEST( PerformanceEstimatorBucketed, Simulation )
+{
+	//   ,    PerformanceEstimator.Simulation.
+	tds::virtual_clock_t clock;
+	tds::performance_estimator_bucketed_t performance_estimator( 10000, 10, 10, 10, clock );
+	for( unsigned int i = 0; i < 24*3600*100; ++i )
+	{
+		performance_estimator.add( 20, 1 + i % 3 );
+		clock.advance( 10 );
+	}
+
+	performance_estimator.cleanup();
+	EXPECT_GE( performance_estimator.snapshot().m_tasks, 900 );
+	EXPECT_LE( performance_estimator.snapshot().m_tasks, 1000 );
+	EXPECT_FLOAT_EQ( performance_estimator.get_estimate_performance_in_tasks(), 1000.0/20 );
+	EXPECT_NEAR( performance_estimator.get_estimate_performance_in_size(), 2*1000.0/20, 0.1 );
+}
+
+TEST( PerformanceEstimator, Factory ) 
+{
+	std::unique_ptr< tds::performance_estimator_interface_t > dummy( 
+		tds::performance_estimator_factory( 
+			tds::performance_estimator::dummy, 200, 10, 10 ) );
+	EXPECT_FALSE( dummy->active() );
+
+	std::unique_ptr< tds::performance_estimator_interface_t > simple( 
+		tds::performance_estimator_factory( 
+			tds::performance_estimator::simple, 200, 10, 10 ) );
+	std::unique_ptr< tds::performance_estimator_interface_t > bucketed( 
+		tds::performance_estimator_factory( 
+			tds::performance_estimator::bucketed, 200, 10, 10 ) );
+	EXPECT_TRUE( simple->active() );
+	EXPECT_TRUE( bucketed->active() );
+
+	simple->add( 200, 5 );
+	bucketed->add( 200, 5 );
+	EXPECT_FLOAT_EQ( bucketed->get_estimate_performance_in_size(), 
+		simple->get_estimate_performance_in_size() );
+	EXPECT_FLOAT_EQ( bucketed->get_estimate_performance_in_tasks(), 
+		simple->get_estimate_performance_in_tasks() );
+}
+
+} /* namespace tds */
 
 int main( int argc, char ** argv ) 
 {
@@ -0,0 +1,129 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/prefix_sum_counter.hpp>
+#include <tds/h/sum_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::prefix_sum_counter_t sum_counter( 10 );
+
+	EXPECT_EQ( sum_counter.total(), 0 );
+	EXPECT_EQ( sum_counter.sum(), 0 );
+	EXPECT_EQ( sum_counter.sum_last( 5 ), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.mean_last( 5 ), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::prefix_sum_counter_t sum_counter( 0 ), std::exception );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 10;
+	tds::prefix_sum_counter_t sum_counter( number );
+
+	for( unsigned int i = 1; i <= number; ++i )
+		sum_counter.event( i );
+
+	EXPECT_EQ( sum_counter.total(), number );
+	EXPECT_EQ( sum_counter.sum(), 55 );
+	EXPECT_EQ( sum_counter.sum_last( 1 ), 10 );
+	EXPECT_EQ( sum_counter.sum_last( 3 ), 10 + 9 + 8 );
+	EXPECT_EQ( sum_counter.sum_last( 100 ), 55 );
+	EXPECT_FLOAT_EQ( sum_counter.mean_last( 4 ), ( 10 + 9 + 8 + 7 ) / 4.0 );
+
+	sum_counter.event( 0 );
+	EXPECT_EQ( sum_counter.sum(), 54 );
+	EXPECT_EQ( sum_counter.sum_last( 2 ), 10 );
+}
+
+TEST( Run, Wide )
+{
+	const unsigned int number = 10;
+	tds::prefix_sum_counter_t sum_counter( number );
+
+	for( unsigned int i = 0; i < 3 * number; ++i )
+		sum_counter.event( UINT_MAX );
+
+	EXPECT_EQ( sum_counter.sum(), 10ULL * UINT_MAX );
+}
+
+TEST( Run, Horizons )
+{
+	const unsigned int horizons[] = { 1, 10, 100, 1000 };
+	const unsigned int number = 1000;
+	tds::prefix_sum_counter_t sum_counter( number );
+
+	tds::sum_counter_t * references[ 4 ];
+	for( unsigned int j = 0; j < 4; ++j )
+		references[j] = new tds::sum_counter_t( horizons[j] );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 5 * number; ++i )
+	{
+		const unsigned int value = std::rand() % 10000;
+		sum_counter.event( value );
+
+		for( unsigned int j = 0; j < 4; ++j )
+		{
+			references[j]->event( value );
+			ASSERT_EQ( sum_counter.sum_last( horizons[j] ), references[j]->sum() );
+			ASSERT_FLOAT_EQ( sum_counter.mean_last( horizons[j] ), references[j]->mean() );
+		}
+	}
+
+	for( unsigned int j = 0; j < 4; ++j )
+		delete references[j];
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,155 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/quantile_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <vector>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::quantile_counter_t quantile_counter( 10, 1000 );
+
+	EXPECT_EQ( quantile_counter.total(), 0 );
+	EXPECT_EQ( quantile_counter.quantile( 0.5 ), 0 );
+	EXPECT_EQ( quantile_counter.quantile( 0.99 ), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::quantile_counter_t quantile_counter( 0, 1000 ), std::exception );
+	EXPECT_THROW( tds::quantile_counter_t quantile_counter( 10, 1000, 0 ), std::exception );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 100;
+	tds::quantile_counter_t quantile_counter( number, 1000 );
+
+	for( unsigned int i = 1; i <= number; ++i )
+		quantile_counter.event( i );
+
+	EXPECT_EQ( quantile_counter.total(), number );
+	EXPECT_EQ( quantile_counter.quantile( 0 ), 1 );
+	EXPECT_EQ( quantile_counter.quantile( 0.5 ), 50 );
+	EXPECT_EQ( quantile_counter.quantile( 0.99 ), 99 );
+	EXPECT_EQ( quantile_counter.quantile( 1 ), 100 );
+
+	// Small values go out of the window.
+	for( unsigned int i = 0; i < number / 2; ++i )
+		quantile_counter.event( 500 );
+
+	EXPECT_EQ( quantile_counter.total(), number );
+	EXPECT_EQ( quantile_counter.quantile( 0 ), 51 );
+	EXPECT_EQ( quantile_counter.quantile( 0.5 ), 100 );
+	EXPECT_EQ( quantile_counter.quantile( 0.51 ), 500 );
+}
+
+TEST( Run, Overflow )
+{
+	tds::quantile_counter_t quantile_counter( 10, 100 );
+
+	quantile_counter.event( 5 );
+	quantile_counter.event( 100000 );
+
+	EXPECT_EQ( quantile_counter.quantile( 0.5 ), 5 );
+	EXPECT_EQ( quantile_counter.quantile( 1 ), 100 );
+}
+
+TEST( Run, Buckets )
+{
+	tds::quantile_counter_t quantile_counter( 10, 1000, 10 );
+
+	quantile_counter.event( 1 );
+	quantile_counter.event( 15 );
+	quantile_counter.event( 999 );
+
+	EXPECT_EQ( quantile_counter.quantile( 0 ), 9 );
+	EXPECT_EQ( quantile_counter.quantile( 0.5 ), 19 );
+	EXPECT_EQ( quantile_counter.quantile( 1 ), 999 );
+}
+
+TEST( Run, Reference )
+{
+	const unsigned int max_value = 300;
+	const float quantiles[] = { 0, 0.1, 0.5, 0.9, 0.99, 1 };
+
+	std::srand( 13 );
+	for( unsigned int number = 1; number < 200; number += 17 )
+	{
+		tds::quantile_counter_t quantile_counter( number, max_value );
+		std::deque< unsigned int > reference;
+
+		for( unsigned int i = 0; i < 5 * number; ++i )
+		{
+			const unsigned int value = std::rand() % ( max_value + 1 );
+			quantile_counter.event( value );
+			reference.push_back( value );
+			if ( reference.size() > number )
+				reference.pop_front();
+
+			std::vector< unsigned int > sorted( reference.begin(), reference.end() );
+			std::sort( sorted.begin(), sorted.end() );
+
+			ASSERT_EQ( quantile_counter.total(), sorted.size() );
+			for( unsigned int j = 0; j < sizeof( quantiles ) / sizeof( quantiles[0] ); ++j )
+			{
+				unsigned int rank = static_cast< unsigned int >(
+					std::ceil( quantiles[j] * sorted.size() ) );
+				rank = std::max( rank, 1U );
+
+				ASSERT_EQ( quantile_counter.quantile( quantiles[j] ), sorted[ rank - 1 ] );
+			}
+		}
+	}
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/ring_buffer.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <algorithm>
+#include <deque>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::ring_buffer_t< int > ring_buffer;
+
+	EXPECT_TRUE( ring_buffer.empty() );
+	EXPECT_EQ( ring_buffer.size(), 0 );
+	EXPECT_EQ( ring_buffer.lower_bound( 5 ), 0 );
+
+	ring_buffer.pop_front( 3 );
+	EXPECT_EQ( ring_buffer.size(), 0 );
+}
+
+TEST( Run, Queue )
+{
+	tds::ring_buffer_t< int > ring_buffer;
+
+	for( int i = 0; i < 100; ++i )
+		ring_buffer.push_back( i );
+
+	EXPECT_EQ( ring_buffer.size(), 100 );
+	EXPECT_EQ( ring_buffer.capacity(), 128 );
+	EXPECT_EQ( ring_buffer.front(), 0 );
+	EXPECT_EQ( ring_buffer.back(), 99 );
+
+	ring_buffer.pop_front( 30 );
+	EXPECT_EQ( ring_buffer.size(), 70 );
+	EXPECT_EQ( ring_buffer.front(), 30 );
+	for( int i = 0; i < 70; ++i )
+		EXPECT_EQ( ring_buffer[i], 30 + i );
+
+	ring_buffer.pop_front( 1000 );
+	EXPECT_TRUE( ring_buffer.empty() );
+}
+
+TEST( Run, SteadyState )
+{
+	tds::ring_buffer_t< int > ring_buffer;
+
+	for( int i = 0; i < 10; ++i )
+		ring_buffer.push_back( i );
+	const unsigned int capacity = ring_buffer.capacity();
+
+	// Window of 10 values goes around the buffer many times.
+	for( int i = 10; i < 10000; ++i )
+	{
+		ring_buffer.push_back( i );
+		ring_buffer.pop_front( 1 );
+		ASSERT_EQ( ring_buffer.front(), i - 9 );
+		ASSERT_EQ( ring_buffer.back(), i );
+	}
+
+	EXPECT_EQ( ring_buffer.capacity(), capacity );
+}
+
+TEST( Run, Grow )
+{
+	tds::ring_buffer_t< int > ring_buffer;
+	std::deque< int > reference;
+
+	// Buffer grows while values are wrapped around.
+	for( int i = 0; i < 1000; ++i )
+	{
+		ring_buffer.push_back( i );
+		reference.push_back( i );
+		if ( i % 3 == 0 )
+		{
+			ring_buffer.pop_front( 1 );
+			reference.pop_front();
+		}
+	}
+
+	ASSERT_EQ( ring_buffer.size(), reference.size() );
+	for( unsigned int i = 0; i < reference.size(); ++i )
+		ASSERT_EQ( ring_buffer[i], reference[i] );
+}
+
+TEST( Run, LowerBound )
+{
+	tds::ring_buffer_t< int > ring_buffer;
+	std::deque< int > reference;
+
+	for( int i = 0; i < 16; ++i )
+	{
+		ring_buffer.push_back( 2 * i );
+		reference.push_back( 2 * i );
+	}
+
+	// Values are in two segments of the buffer.
+	for( int i = 16; i < 40; ++i )
+	{
+		ring_buffer.pop_front( 1 );
+		reference.pop_front();
+		ring_buffer.push_back( 2 * i );
+		reference.push_back( 2 * i );
+
+		for( int value = reference.front() - 1; value <= reference.back() + 1; ++value )
+			ASSERT_EQ( ring_buffer.lower_bound( value ),
+				std::lower_bound( reference.begin(), reference.end(), value ) -
+					reference.begin() );
+	}
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
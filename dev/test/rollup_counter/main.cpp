@@ -0,0 +1,128 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/rollup_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+namespace tds {
+
+std::vector< unsigned int >
+day()
+{
+	std::vector< unsigned int > levels;
+	levels.push_back( 60 );
+	levels.push_back( 60 );
+	levels.push_back( 24 );
+
+	return levels;
+}
+
+TEST( Start, Simple )
+{
+	tds::rollup_counter_t rollup_counter( day() );
+
+	EXPECT_EQ( rollup_counter.levels(), 3 );
+	for( unsigned int level = 0; level < 3; ++level )
+	{
+		EXPECT_EQ( rollup_counter.total( level ), 0 );
+		EXPECT_EQ( rollup_counter.sum( level, 10 ), 0 );
+		EXPECT_FLOAT_EQ( rollup_counter.mean( level, 10 ), 0 );
+	}
+}
+
+TEST( Start, Null )
+{
+	const std::vector< unsigned int > empty;
+	EXPECT_THROW( tds::rollup_counter_t rollup_counter( empty ), std::exception );
+
+	const std::vector< unsigned int > nulls( 2, 0 );
+	EXPECT_THROW( tds::rollup_counter_t rollup_counter( nulls ), std::exception );
+}
+
+TEST( Run, Rollup )
+{
+	tds::rollup_counter_t rollup_counter( day() );
+
+	// 59 seconds.
+	for( unsigned int i = 0; i < 59; ++i )
+		rollup_counter.event( 10 );
+	EXPECT_EQ( rollup_counter.total( 0 ), 59 );
+	EXPECT_EQ( rollup_counter.total( 1 ), 0 );
+
+	// The first minute is closed.
+	rollup_counter.event( 10 );
+	EXPECT_EQ( rollup_counter.total( 1 ), 1 );
+	EXPECT_EQ( rollup_counter.sum( 1, 1 ), 600 );
+
+	// Minutes 2-61 are 60, minutes 62-121 are 120.
+	for( unsigned int i = 0; i < 60 * 60 * 2; ++i )
+		rollup_counter.event( i < 60 * 60 ? 1 : 2 );
+
+	EXPECT_EQ( rollup_counter.total( 0 ), 60 );
+	EXPECT_EQ( rollup_counter.sum( 0, 60 ), 120 );
+	EXPECT_EQ( rollup_counter.total( 1 ), 60 );
+	EXPECT_EQ( rollup_counter.sum( 1, 1 ), 120 );
+	EXPECT_EQ( rollup_counter.sum( 1, 60 ), 60 * 120 );
+
+	// Hours are minutes 1-60 and 61-120.
+	const unsigned int first_hour = 600 + 59 * 60;
+	const unsigned int second_hour = 60 + 59 * 120;
+	EXPECT_EQ( rollup_counter.total( 2 ), 2 );
+	EXPECT_EQ( rollup_counter.sum( 2, 1 ), second_hour );
+	EXPECT_EQ( rollup_counter.sum( 2, 2 ), first_hour + second_hour );
+	EXPECT_FLOAT_EQ( rollup_counter.mean( 2, 2 ), ( first_hour + second_hour ) / 2.0 );
+}
+
+TEST( Run, Wide )
+{
+	tds::rollup_counter_t rollup_counter( day() );
+
+	for( unsigned int i = 0; i < 60 * 60; ++i )
+		rollup_counter.event( UINT_MAX );
+
+	EXPECT_EQ( rollup_counter.sum( 2, 1 ), 3600ULL * UINT_MAX );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
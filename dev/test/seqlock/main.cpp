@@ -0,0 +1,150 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/seqlock.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+struct triple_t
+{
+	unsigned int m_first;
+	unsigned long long m_second;
+	float m_third;
+};
+
+TEST( Start, Simple )
+{
+	tds::seqlock_t< triple_t > seqlock;
+
+	const triple_t value = seqlock.load();
+	EXPECT_EQ( value.m_first, 0 );
+	EXPECT_EQ( value.m_second, 0 );
+	EXPECT_FLOAT_EQ( value.m_third, 0 );
+}
+
+TEST( Run, Store )
+{
+	triple_t value = { 1, 2, 3 };
+	tds::seqlock_t< triple_t > seqlock( value );
+
+	EXPECT_EQ( seqlock.load().m_first, 1 );
+	EXPECT_EQ( seqlock.load().m_second, 2 );
+	EXPECT_FLOAT_EQ( seqlock.load().m_third, 3 );
+
+	value.m_first = 4;
+	value.m_second = 5;
+	value.m_third = 6;
+	seqlock.store( value );
+
+	EXPECT_EQ( seqlock.load().m_first, 4 );
+	EXPECT_EQ( seqlock.load().m_second, 5 );
+	EXPECT_FLOAT_EQ( seqlock.load().m_third, 6 );
+}
+
+TEST( Run, Copy )
+{
+	triple_t value = { 1, 2, 3 };
+	tds::seqlock_t< triple_t > seqlock( value );
+
+	tds::seqlock_t< triple_t > copy( seqlock );
+	EXPECT_EQ( copy.load().m_first, 1 );
+	EXPECT_EQ( copy.load().m_second, 2 );
+
+	value.m_first = 4;
+	seqlock.store( value );
+	EXPECT_EQ( copy.load().m_first, 1 );
+
+	copy = seqlock;
+	EXPECT_EQ( copy.load().m_first, 4 );
+
+	std::vector< tds::seqlock_t< triple_t > > values( 3, seqlock );
+	values.push_back( copy );
+	EXPECT_EQ( values.back().load().m_first, 4 );
+}
+
+TEST( Stress, Consistency )
+{
+	const unsigned int readers = 4;
+	const unsigned int values = 200000;
+	tds::seqlock_t< triple_t > seqlock;
+	std::atomic< bool > done( false );
+	std::atomic< unsigned int > torn( 0 );
+	std::atomic< unsigned int > backward( 0 );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < readers; ++t )
+		workers.push_back( std::thread( [&]() {
+			unsigned int last = 0;
+			while( !done.load() )
+			{
+				const triple_t value = seqlock.load();
+				if ( value.m_second != value.m_first * 3ULL ||
+					value.m_third != static_cast< float >( value.m_first % 1000 ) )
+					++torn;
+				if ( value.m_first < last )
+					++backward;
+				last = value.m_first;
+			}
+		} ) );
+
+	for( unsigned int i = 1; i <= values; ++i )
+	{
+		const triple_t value = { i, i * 3ULL, static_cast< float >( i % 1000 ) };
+		seqlock.store( value );
+	}
+	done = true;
+
+	for( unsigned int t = 0; t < readers; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( torn.load(), 0 );
+	EXPECT_EQ( backward.load(), 0 );
+	EXPECT_EQ( seqlock.load().m_first, values );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
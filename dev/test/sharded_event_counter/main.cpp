@@ -0,0 +1,186 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/sharded_event_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <thread>
+#include <vector>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::sharded_event_counter_t event_counter( 10, 4 );
+
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+	EXPECT_EQ( event_counter.shards(), 4 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::sharded_event_counter_t event_counter( 0 ), std::exception );
+}
+
+TEST( Start, Shards )
+{
+	tds::sharded_event_counter_t by_hardware( 1000 );
+	EXPECT_GE( by_hardware.shards(), 1 );
+
+	tds::sharded_event_counter_t small( 3, 8 );
+	EXPECT_EQ( small.shards(), 3 );
+}
+
+TEST( Overload, AllTrue )
+{
+	const unsigned int number = 10;
+	tds::sharded_event_counter_t event_counter( number, 1 );
+	ASSERT_EQ( event_counter.total(), 0 );
+
+	for( unsigned int i = 0; i < 2*number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_FLOAT_EQ( event_counter.percentage(), 100 );
+	}
+	ASSERT_EQ( event_counter.total(), number );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 10;
+	tds::sharded_event_counter_t event_counter( number, 1 );
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( true );
+		EXPECT_EQ( event_counter.total(), i+1  );
+		EXPECT_EQ( event_counter.count(), i+1  );
+	}
+
+	for( unsigned int i = 0; i < number; ++i )
+	{
+		event_counter.event( false );
+		EXPECT_EQ( event_counter.total(), number  );
+		EXPECT_EQ( event_counter.count(), number-i-1  );
+	}
+}
+
+TEST( Run, Shards )
+{
+	// Windows of shards are 4, 3, 3.
+	const unsigned int number = 10;
+	tds::sharded_event_counter_t event_counter( number, 3 );
+
+	for( unsigned int i = 0; i < 10; ++i )
+		event_counter.event( true, 0 );
+	EXPECT_EQ( event_counter.total(), 4 );
+	EXPECT_EQ( event_counter.count(), 4 );
+
+	for( unsigned int i = 0; i < 10; ++i )
+		event_counter.event( false, 1 );
+	EXPECT_EQ( event_counter.total(), 7 );
+	EXPECT_EQ( event_counter.count(), 4 );
+
+	// Shard 5 is shard 2.
+	event_counter.event( true, 5 );
+	EXPECT_EQ( event_counter.total(), 8 );
+	EXPECT_EQ( event_counter.count(), 5 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 5*100.0/8 );
+
+	for( unsigned int i = 0; i < 4; ++i )
+		event_counter.event( false, 0 );
+	EXPECT_EQ( event_counter.total(), 8 );
+	EXPECT_EQ( event_counter.count(), 1 );
+}
+
+TEST( Stress, AllTrue )
+{
+	const unsigned int number = 100;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::sharded_event_counter_t event_counter( number, 4 );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&event_counter]() {
+			for( unsigned int i = 0; i < events; ++i )
+				event_counter.event( true );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	EXPECT_EQ( event_counter.total(), number );
+	EXPECT_EQ( event_counter.count(), number );
+}
+
+TEST( Stress, Consistency )
+{
+	const unsigned int number = 128;
+	const unsigned int threads = 8;
+	const unsigned int events = 100000;
+	tds::sharded_event_counter_t event_counter( number, 2 );
+
+	std::vector< std::thread > workers;
+	for( unsigned int t = 0; t < threads; ++t )
+		workers.push_back( std::thread( [&event_counter, t]() {
+			for( unsigned int i = 0; i < events; ++i )
+				event_counter.event( ( i + t ) % 2 == 0 );
+		} ) );
+
+	for( unsigned int t = 0; t < threads; ++t )
+		workers[t].join();
+
+	// Whole window is rewritten by one thread.
+	for( unsigned int i = 0; i < number; ++i )
+		event_counter.event( i % 4 == 0, i );
+
+	EXPECT_EQ( event_counter.total(), number );
+	EXPECT_EQ( event_counter.count(), number / 4 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/sliding_aggregator.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cstdlib>
+#include <deque>
+#include <functional>
+
+namespace tds {
+
+//! First and last values of the range, order is important.
+struct range_t
+{
+	int m_first;
+	int m_last;
+
+	range_t() : m_first( 0 ), m_last( 0 ) {}
+	range_t( int first, int last ) : m_first( first ), m_last( last ) {}
+};
+
+struct join_t
+{
+	range_t
+	operator()( const range_t & left, const range_t & right ) const
+	{
+		return range_t( left.m_first, right.m_last );
+	}
+};
+
+typedef tds::sliding_aggregator_t<
+	unsigned int, tds::sliding_aggregator::max_t< unsigned int > > max_aggregator_t;
+
+typedef tds::sliding_aggregator_t<
+	int, tds::sliding_aggregator::min_t< int > > min_aggregator_t;
+
+typedef tds::sliding_aggregator_t<
+	unsigned int, std::bit_or< unsigned int > > or_aggregator_t;
+
+TEST( Start, Simple )
+{
+	max_aggregator_t aggregator( 10 );
+
+	EXPECT_EQ( aggregator.total(), 0 );
+	EXPECT_EQ( aggregator.aggregate(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( max_aggregator_t aggregator( 0 ), std::exception );
+}
+
+TEST( Run, Max )
+{
+	const unsigned int number = 5;
+	max_aggregator_t aggregator( number );
+
+	for( unsigned int i = 1; i <= number; ++i )
+	{
+		aggregator.event( 10 * i );
+		EXPECT_EQ( aggregator.aggregate(), 10 * i );
+		EXPECT_EQ( aggregator.total(), i );
+	}
+
+	// Maximum goes out of the window only after N events.
+	for( unsigned int i = 0; i < number - 1; ++i )
+	{
+		aggregator.event( 1 );
+		EXPECT_EQ( aggregator.aggregate(), 10 * number );
+	}
+	aggregator.event( 1 );
+	EXPECT_EQ( aggregator.aggregate(), 1 );
+	EXPECT_EQ( aggregator.total(), number );
+}
+
+template< typename AGGREGATOR, typename OPERATION, typename GENERATOR >
+void
+check_reference( unsigned int number, GENERATOR generator )
+{
+	AGGREGATOR aggregator( number );
+	std::deque< decltype( generator( 0 ) ) > reference;
+	OPERATION operation;
+
+	for( unsigned int i = 0; i < 5 * number + 7; ++i )
+	{
+		const auto value = generator( i );
+		aggregator.event( value );
+		reference.push_back( value );
+		if ( reference.size() > number )
+			reference.pop_front();
+
+		auto expected = reference.front();
+		for( unsigned int j = 1; j < reference.size(); ++j )
+			expected = operation( expected, reference[j] );
+
+		ASSERT_EQ( aggregator.total(), reference.size() );
+		ASSERT_EQ( aggregator.aggregate(), expected ) << "number " << number << ", event " << i;
+	}
+}
+
+TEST( Run, Reference )
+{
+	std::srand( 13 );
+	for( unsigned int number = 1; number < 40; ++number )
+	{
+		check_reference< max_aggregator_t, tds::sliding_aggregator::max_t< unsigned int > >(
+			number, []( unsigned int ) { return static_cast< unsigned int >( std::rand() % 1000 ); } );
+
+		check_reference< min_aggregator_t, tds::sliding_aggregator::min_t< int > >(
+			number, []( unsigned int ) { return std::rand() % 1000 - 500; } );
+
+		check_reference< or_aggregator_t, std::bit_or< unsigned int > >(
+			number, []( unsigned int ) { return 1U << ( std::rand() % 32 ); } );
+	}
+}
+
+TEST( Run, Order )
+{
+	for( unsigned int number = 1; number < 40; ++number )
+	{
+		tds::sliding_aggregator_t< range_t, join_t > aggregator( number );
+
+		for( int i = 0; i < 5 * static_cast< int >( number ) + 7; ++i )
+		{
+			aggregator.event( range_t( i, i ) );
+
+			const range_t range = aggregator.aggregate();
+			ASSERT_EQ( range.m_first, std::max( 0, i + 1 - static_cast< int >( number ) ) );
+			ASSERT_EQ( range.m_last, i );
+		}
+	}
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
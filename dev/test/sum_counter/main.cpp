@@ -39,6 +39,11 @@
 
 #include <stdexcept>
 
+#include <cstdlib>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace tds {
 
 TEST( Start, Simple ) 
@@ -118,6 +123,258 @@ TEST( Run, Values )
 	}
 }
 
+TEST( Batch, EventN )
+{
+	const unsigned int number = 10;
+	tds::sum_counter_t batch( number );
+	tds::sum_counter_t single( number );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 200; ++i )
+	{
+		const unsigned int value = std::rand() % 100;
+		const unsigned int n = std::rand() % ( i % 10 == 0 ? 25 : 7 );
+
+		batch.event_n( value, n );
+		for( unsigned int j = 0; j < n; ++j )
+			single.event( value );
+
+		ASSERT_EQ( batch.total(), single.total() );
+		ASSERT_EQ( batch.sum(), single.sum() );
+	}
+}
+
+TEST( Batch, Events )
+{
+	const unsigned int number = 10;
+	tds::sum_counter_t batch( number );
+	tds::sum_counter_t single( number );
+
+	std::vector< unsigned int > values;
+	for( unsigned int i = 0; i < 7; ++i )
+		values.push_back( i * i );
+
+	for( unsigned int i = 0; i < 5; ++i )
+	{
+		batch.events( values.begin(), values.end() );
+		for( unsigned int j = 0; j < values.size(); ++j )
+			single.event( values[j] );
+
+		ASSERT_EQ( batch.total(), single.total() );
+		ASSERT_EQ( batch.sum(), single.sum() );
+
+		// Ordering is kept: the last events are 1.
+		batch.event_n( 1, 4 );
+		for( unsigned int j = 0; j < 4; ++j )
+			single.event( 1 );
+		ASSERT_EQ( batch.sum(), single.sum() );
+	}
+}
+
+TEST( Snapshot, Values )
+{
+	const unsigned int number = 10;
+	tds::sum_counter_t sum_counter( number );
+
+	tds::sum_counter_snapshot_t snapshot = sum_counter.snapshot();
+	EXPECT_EQ( snapshot.m_sum, 0 );
+	EXPECT_EQ( snapshot.m_total, 0 );
+	EXPECT_FLOAT_EQ( snapshot.mean(), 0 );
+
+	for( unsigned int i = 1; i <= 4; ++i )
+		sum_counter.event( i );
+
+	snapshot = sum_counter.snapshot();
+	EXPECT_EQ( snapshot.m_sum, 10 );
+	EXPECT_EQ( snapshot.m_total, 4 );
+	EXPECT_FLOAT_EQ( snapshot.mean(), 2.5 );
+
+	sum_counter.event_n( 3, 20 );
+	snapshot = sum_counter.snapshot();
+	EXPECT_EQ( snapshot.m_sum, 30 );
+	EXPECT_EQ( snapshot.m_total, number );
+}
+
+TEST( Snapshot, Copy )
+{
+	tds::sum_counter_t sum_counter( 3 );
+	sum_counter.event( 10 );
+	sum_counter.event( 20 );
+
+	tds::sum_counter_t copy( sum_counter );
+	EXPECT_EQ( copy.sum(), 30 );
+	EXPECT_EQ( copy.snapshot().m_total, 2 );
+
+	// Copies are independent.
+	copy.event( 30 );
+	copy.event( 40 );
+	EXPECT_EQ( copy.sum(), 90 );
+	EXPECT_EQ( sum_counter.sum(), 30 );
+	EXPECT_EQ( sum_counter.snapshot().m_sum, 30 );
+
+	std::vector< tds::sum_counter_t > counters( 2, sum_counter );
+	counters.push_back( copy );
+	counters[0] = copy;
+	EXPECT_EQ( counters[0].snapshot().m_sum, 90 );
+	EXPECT_EQ( counters[1].snapshot().m_sum, 30 );
+}
+
+TEST( Snapshot, Stress )
+{
+	const unsigned int number = 1000;
+	const unsigned int events = 200000;
+	tds::sum_counter_t sum_counter( number );
+	std::atomic< bool > done( false );
+	std::atomic< unsigned int > torn( 0 );
+
+	// Only 5-events, so sum must be 5 * total.
+	std::thread reader( [&]() {
+		while( !done.load() )
+		{
+			const tds::sum_counter_snapshot_t snapshot =
+				sum_counter.snapshot();
+			if ( snapshot.m_sum != 5 * snapshot.m_total )
+				++torn;
+		}
+	} );
+
+	for( unsigned int i = 0; i < events; ++i )
+		sum_counter.event( 5 );
+	done = true;
+	reader.join();
+
+	EXPECT_EQ( torn.load(), 0 );
+	EXPECT_EQ( sum_counter.snapshot().m_sum, 5 * number );
+}
+
+TEST( Template, WideAccumulator )
+{
+	const unsigned int number = 100000;
+	tds::basic_sum_counter_t< unsigned short, unsigned long long > sum_counter( number );
+
+	for( unsigned int i = 0; i < number; ++i )
+		sum_counter.event( 65535 );
+
+	EXPECT_EQ( sum_counter.sum(), 65535ULL * number );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 65535 );
+
+	sum_counter.event_n( 60000, number / 2 );
+	EXPECT_EQ( sum_counter.sum(), 65535ULL * number / 2 + 60000ULL * number / 2 );
+	EXPECT_EQ( sum_counter.snapshot().m_sum, sum_counter.sum() );
+}
+
+TEST( Template, CompensatedSum )
+{
+	const unsigned int number = 10;
+	tds::basic_sum_counter_t< double, tds::compensated_sum_t< double > > sum_counter( number );
+
+	// Low bits of small values next to big ones are lost by plain double sum.
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 10000; ++i )
+		if ( i % 7 == 0 )
+			sum_counter.event( 1e15 );
+		else
+			sum_counter.event( std::rand() % 1000 / 1000.0 );
+
+	// Big values go out of the window by one.
+	for( unsigned int i = 0; i < number; ++i )
+		sum_counter.event( 0.1 );
+
+	EXPECT_NEAR( sum_counter.sum(), 1.0, 1e-9 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 0.1 );
+
+	sum_counter.event_n( 0.25, 4 );
+	EXPECT_NEAR( sum_counter.sum(), 1.6, 1e-9 );
+}
+
+typedef tds::basic_sum_counter_t< unsigned int, unsigned int,
+	tds::window_policy::tumbling_t > tumbling_sum_counter_t;
+
+typedef tds::basic_sum_counter_t< unsigned int, unsigned int,
+	tds::window_policy::hopping_t > hopping_sum_counter_t;
+
+TEST( Window, Tumbling )
+{
+	const unsigned int number = 4;
+	tumbling_sum_counter_t sum_counter( number );
+
+	for( unsigned int i = 1; i <= number; ++i )
+	{
+		sum_counter.event( i );
+		EXPECT_EQ( sum_counter.total(), i );
+	}
+	EXPECT_EQ( sum_counter.sum(), 10 );
+
+	// The next window is started from scratch.
+	sum_counter.event( 7 );
+	EXPECT_EQ( sum_counter.total(), 1 );
+	EXPECT_EQ( sum_counter.sum(), 7 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 7 );
+
+	sum_counter.event_n( 1, 3 );
+	EXPECT_EQ( sum_counter.total(), 4 );
+	EXPECT_EQ( sum_counter.sum(), 10 );
+
+	// 4 events of the full window and 2 of the next one.
+	sum_counter.event_n( 2, 6 );
+	EXPECT_EQ( sum_counter.total(), 2 );
+	EXPECT_EQ( sum_counter.sum(), 4 );
+
+	sum_counter.event_n( 3, 2 );
+	EXPECT_EQ( sum_counter.total(), 4 );
+	EXPECT_EQ( sum_counter.sum(), 10 );
+	EXPECT_EQ( sum_counter.snapshot().m_sum, 10 );
+}
+
+TEST( Window, TumblingReference )
+{
+	const unsigned int number = 7;
+	tumbling_sum_counter_t batch( number );
+	tumbling_sum_counter_t single( number );
+
+	std::srand( 13 );
+	for( unsigned int i = 0; i < 100; ++i )
+	{
+		const unsigned int value = std::rand() % 100;
+		const unsigned int n = std::rand() % 20;
+
+		batch.event_n( value, n );
+		for( unsigned int j = 0; j < n; ++j )
+			single.event( value );
+
+		ASSERT_EQ( batch.total(), single.total() );
+		ASSERT_EQ( batch.sum(), single.sum() );
+	}
+}
+
+TEST( Window, Hopping )
+{
+	const unsigned int number = 4;
+	hopping_sum_counter_t sum_counter( number, tds::window_policy::hopping_t( 2 ) );
+
+	sum_counter.event( 1 );
+	EXPECT_EQ( sum_counter.total(), 0 );
+	EXPECT_EQ( sum_counter.sum(), 0 );
+
+	sum_counter.event( 2 );
+	EXPECT_EQ( sum_counter.total(), 2 );
+	EXPECT_EQ( sum_counter.sum(), 3 );
+
+	sum_counter.event( 3 );
+	sum_counter.event( 4 );
+	sum_counter.event( 5 );
+	EXPECT_EQ( sum_counter.total(), 4 );
+	EXPECT_EQ( sum_counter.sum(), 10 );
+	EXPECT_EQ( sum_counter.snapshot().m_sum, 10 );
+
+	// Window of last 4 events: 3, 4, 5, 6.
+	sum_counter.event( 6 );
+	EXPECT_EQ( sum_counter.sum(), 18 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 4.5 );
+
+	EXPECT_THROW( tds::window_policy::hopping_t( 0 ), std::exception );
+}
+
 } /* namespace tds */
 
 int 
@@ -0,0 +1,118 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/time_buckets.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::time_buckets_t< unsigned int > buckets( 1000, 10 );
+
+	EXPECT_EQ( buckets.sum(), 0 );
+	EXPECT_EQ( buckets.buckets(), 10 );
+	EXPECT_EQ( buckets.bucket_period(), 100 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::time_buckets_t< unsigned int > buckets( 1000, 0 ), std::exception );
+	EXPECT_THROW( tds::time_buckets_t< unsigned int > buckets( 5, 10 ), std::exception );
+	EXPECT_THROW( tds::time_buckets_t< unsigned int > buckets( 1005, 10 ), std::exception );
+}
+
+TEST( Run, Window )
+{
+	tds::time_buckets_t< unsigned int > buckets( 1000, 10 );
+	const unsigned long long start = 1000000;
+
+	buckets.add( start, 1 );
+	buckets.add( start + 50, 2 );
+	buckets.add( start + 150, 3 );
+	EXPECT_EQ( buckets.sum(), 6 );
+
+	// The first bucket is still in the window.
+	EXPECT_EQ( buckets.rotate( start + 999 ), 0 );
+	EXPECT_EQ( buckets.sum(), 6 );
+
+	// The first bucket is expired.
+	EXPECT_EQ( buckets.rotate( start + 1000 ), 3 );
+	EXPECT_EQ( buckets.sum(), 3 );
+
+	buckets.add( start + 1050, 4 );
+	EXPECT_EQ( buckets.sum(), 7 );
+
+	EXPECT_EQ( buckets.rotate( start + 1100 ), 3 );
+	EXPECT_EQ( buckets.sum(), 4 );
+}
+
+TEST( Run, LongPause )
+{
+	tds::time_buckets_t< unsigned int > buckets( 1000, 10 );
+	const unsigned long long start = 1000000;
+
+	for( unsigned int i = 0; i < 10; ++i )
+		buckets.add( start + i * 100, 1 );
+	EXPECT_EQ( buckets.sum(), 10 );
+
+	EXPECT_EQ( buckets.add( start + 100000, 5 ), 10 );
+	EXPECT_EQ( buckets.sum(), 5 );
+}
+
+TEST( Run, TimeBack )
+{
+	tds::time_buckets_t< unsigned int > buckets( 1000, 10 );
+	const unsigned long long start = 1000000;
+
+	buckets.add( start + 500, 1 );
+	buckets.add( start, 1 );
+	EXPECT_EQ( buckets.sum(), 2 );
+
+	EXPECT_EQ( buckets.rotate( start + 1500 ), 2 );
+	EXPECT_EQ( buckets.sum(), 0 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,107 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/time_event_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <tds/h/clock.hpp>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::time_event_counter_t event_counter( 200 );
+
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::time_event_counter_t event_counter( 200, 0 ), std::exception );
+}
+
+TEST( Run, Values )
+{
+	tds::time_event_counter_t event_counter( 200, 4 );
+
+	for( unsigned int i = 0; i < 10; ++i )
+	{
+		event_counter.event( i % 2 == 0 );
+		EXPECT_EQ( event_counter.total(), i+1 );
+	}
+	EXPECT_EQ( event_counter.count(), 5 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 50 );
+}
+
+TEST( Run, TimeCleanup )
+{
+	tds::virtual_clock_t clock;
+	tds::time_event_counter_t event_counter( 200, 4, clock );
+
+	event_counter.event( true );
+	event_counter.event( true );
+	EXPECT_EQ( event_counter.total(), 2 );
+
+	clock.advance( 100 );
+
+	event_counter.event( false );
+	EXPECT_EQ( event_counter.total(), 3 );
+	EXPECT_EQ( event_counter.count(), 2 );
+
+	clock.advance( 150 );
+
+	EXPECT_EQ( event_counter.total(), 1 );
+	EXPECT_EQ( event_counter.count(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+
+	clock.advance( 250 );
+
+	EXPECT_EQ( event_counter.total(), 0 );
+	EXPECT_FLOAT_EQ( event_counter.percentage(), 0 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/time_sum_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <tds/h/clock.hpp>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::time_sum_counter_t sum_counter( 200 );
+
+	EXPECT_EQ( sum_counter.total(), 0 );
+	EXPECT_EQ( sum_counter.sum(), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.rate_per_second(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::time_sum_counter_t sum_counter( 200, 0 ), std::exception );
+}
+
+TEST( Run, Values )
+{
+	tds::time_sum_counter_t sum_counter( 200, 4 );
+
+	for( unsigned int i = 1; i <= 10; ++i )
+	{
+		sum_counter.event( i );
+		EXPECT_EQ( sum_counter.total(), i );
+	}
+	EXPECT_EQ( sum_counter.sum(), 55 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 5.5 );
+	EXPECT_FLOAT_EQ( sum_counter.rate_per_second(), 55 * 1000.0 / 200 );
+}
+
+TEST( Run, Wide )
+{
+	tds::time_sum_counter_t sum_counter( 1000 );
+
+	sum_counter.event( UINT_MAX );
+	sum_counter.event( UINT_MAX );
+	EXPECT_EQ( sum_counter.sum(), 2ULL * UINT_MAX );
+}
+
+TEST( Run, TimeCleanup )
+{
+	tds::virtual_clock_t clock;
+	tds::time_sum_counter_t sum_counter( 200, 4, clock );
+
+	sum_counter.event( 10 );
+	sum_counter.event( 20 );
+	EXPECT_EQ( sum_counter.sum(), 30 );
+
+	clock.advance( 100 );
+
+	sum_counter.event( 5 );
+	EXPECT_EQ( sum_counter.total(), 3 );
+	EXPECT_EQ( sum_counter.sum(), 35 );
+
+	clock.advance( 150 );
+
+	EXPECT_EQ( sum_counter.total(), 1 );
+	EXPECT_EQ( sum_counter.sum(), 5 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 5 );
+	EXPECT_FLOAT_EQ( sum_counter.rate_per_second(), 5 * 1000.0 / 200 );
+
+	clock.advance( 250 );
+
+	EXPECT_EQ( sum_counter.total(), 0 );
+	EXPECT_EQ( sum_counter.sum(), 0 );
+	EXPECT_FLOAT_EQ( sum_counter.mean(), 0 );
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+/*
+	Copyright (c) 2013, Boris Sivko
+	All rights reserved.
+
+	E-mail: bsivko@gmail.com (Boris Sivko)
+
+	This file is part of Telic Data Structures Library.
+
+	Redistribution and use in source and binary forms, with or without 
+	modification, are permitted provided that the following conditions are met:
+
+	Redistributions of source code must retain the above copyright notice, 
+	this list of conditions and the following disclaimer.
+
+	Redistributions in binary form must reproduce the above copyright notice, 
+	this list of conditions and the following disclaimer in the documentation 
+	and/or other materials provided with the distribution.
+
+	Neither the name of the Intervale nor the names of its contributors 
+	may be used to endorse or promote products derived from this software 
+	without specific prior written permission.
+
+	THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+	AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+	THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE 
+	ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE 
+	FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+	DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR 
+	SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+	CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, 
+	OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE 
+	USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <tds/h/variance_counter.hpp>
+
+#include <limits.h>
+#include "gtest/1.6.0/include/gtest/gtest.h"
+
+#include <stdexcept>
+
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+
+namespace tds {
+
+TEST( Start, Simple )
+{
+	tds::variance_counter_t variance_counter( 10 );
+
+	EXPECT_EQ( variance_counter.total(), 0 );
+	EXPECT_EQ( variance_counter.sum(), 0 );
+	EXPECT_FLOAT_EQ( variance_counter.mean(), 0 );
+	EXPECT_FLOAT_EQ( variance_counter.variance(), 0 );
+	EXPECT_FLOAT_EQ( variance_counter.stddev(), 0 );
+	EXPECT_FLOAT_EQ( variance_counter.coefficient_of_variation(), 0 );
+}
+
+TEST( Start, Null )
+{
+	EXPECT_THROW( tds::variance_counter_t variance_counter( 0 ), std::exception );
+}
+
+TEST( Overload, AllTen )
+{
+	const unsigned int number = 10;
+	tds::variance_counter_t variance_counter( number );
+
+	for( unsigned int i = 0; i < 3*number; ++i )
+	{
+		variance_counter.event( 10 );
+		EXPECT_FLOAT_EQ( variance_counter.mean(), 10 );
+		EXPECT_NEAR( variance_counter.variance(), 0, 1e-5 );
+	}
+	ASSERT_EQ( variance_counter.total(), number );
+}
+
+TEST( Run, Values )
+{
+	const unsigned int number = 4;
+	tds::variance_counter_t variance_counter( number );
+
+	variance_counter.event( 2 );
+	variance_counter.event( 4 );
+	variance_counter.event( 4 );
+	variance_counter.event( 6 );
+
+	EXPECT_EQ( variance_counter.sum(), 16 );
+	EXPECT_FLOAT_EQ( variance_counter.mean(), 4 );
+	EXPECT_FLOAT_EQ( variance_counter.variance(), 2 );
+	EXPECT_FLOAT_EQ( variance_counter.stddev(), std::sqrt( 2.0 ) );
+	EXPECT_FLOAT_EQ( variance_counter.coefficient_of_variation(), std::sqrt( 2.0 ) / 4 );
+
+	// 2 goes out of the window: 4, 4, 6, 10.
+	variance_counter.event( 10 );
+	EXPECT_EQ( variance_counter.sum(), 24 );
+	EXPECT_FLOAT_EQ( variance_counter.mean(), 6 );
+	EXPECT_FLOAT_EQ( variance_counter.variance(), 6 );
+}
+
+TEST( Run, Reference )
+{
+	std::srand( 13 );
+	for( unsigned int number = 1; number < 100; number += 7 )
+	{
+		tds::variance_counter_t variance_counter( number );
+		std::deque< unsigned int > reference;
+
+		for( unsigned int i = 0; i < 50 * number; ++i )
+		{
+			// Big values with small jitter.
+			const unsigned int value = 1000000000 + std::rand() % 1000;
+			variance_counter.event( value );
+			reference.push_back( value );
+			if ( reference.size() > number )
+				reference.pop_front();
+
+			double mean = 0;
+			for( unsigned int j = 0; j < reference.size(); ++j )
+				mean += reference[j];
+			mean /= reference.size();
+
+			double variance = 0;
+			for( unsigned int j = 0; j < reference.size(); ++j )
+				variance += ( reference[j] - mean ) * ( reference[j] - mean );
+			variance /= reference.size();
+
+			ASSERT_EQ( variance_counter.total(), reference.size() );
+			ASSERT_NEAR( variance_counter.variance(), variance, 1e-3 * variance + 1e-2 );
+		}
+	}
+}
+
+} /* namespace tds */
+
+int
+main( int argc, char ** argv )
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}